@@ -0,0 +1,91 @@
+// tree of groups_index.html, included as clickEventHandler.<hash>.js
+// (see WriteAssets) and started by the load event
+function addEvents() {
+  activateTree(document.getElementById("LinkedList1"));
+  activateTree(document.getElementById("LinkedList2"));
+}
+
+// This function collapses the list, adds the click-event handler
+// and makes the nested items look like links.
+// Every list item is visited once.
+function activateTree(oList) {
+  if (!oList) return;
+  var cBranches = oList.getElementsByTagName("li");
+  var i, n, oSubBranch;
+  for (i=0, n = cBranches.length; i < n; i++) {
+    oSubBranch = getSubBranch(cBranches[i]);
+    if (oSubBranch) {
+      oSubBranch.style.display = "none";
+      oSubBranch.style.color = "black";
+      oSubBranch.style.cursor = "auto";
+      cBranches[i].className = "HandCursorStyle";
+      cBranches[i].style.color = "blue";
+    }
+  }
+  // Add the click-event handler to the list items
+  if (oList.addEventListener) {
+    oList.addEventListener("click", toggleBranch, false);
+  } else if (oList.attachEvent) { // For IE
+    oList.attachEvent("onclick", toggleBranch);
+  }
+}
+
+// the list directly nested in a list item
+function getSubBranch(oItem) {
+  for (var oChild = oItem.firstChild; oChild; oChild = oChild.nextSibling) {
+    if (oChild.nodeName == "UL") return oChild;
+  }
+  return null;
+}
+
+// Fetches the table of a group from its page (data-group), where
+// it is marked with <!--group--> ... <!--/group-->
+function loadGroup(oItem, oSubBranch) {
+  var url = oItem.getAttribute("data-group");
+  oItem.removeAttribute("data-group");
+  oSubBranch.innerHTML = "<li>loading ...</li>";
+  var req = new XMLHttpRequest();
+  req.onreadystatechange = function() {
+    if (req.readyState != 4) return;
+    var text = req.responseText || "";
+    var begin = text.indexOf("<!--group-->");
+    var end = text.indexOf("<!--/group-->");
+    if (begin >= 0 && end > begin) {
+      oSubBranch.innerHTML = "<li>" + text.substring(begin + 12, end) + "</li>";
+    } else {
+      // e.g. the browser doesn't allow requests to local files
+      window.location.href = url;
+    }
+  };
+  try {
+    req.open("GET", url, true);
+    req.send(null);
+  } catch (e) {
+    window.location.href = url;
+  }
+}
+
+// This is the click-event handler
+function toggleBranch(event) {
+  var oBranch, oSubBranch;
+  if (event.target) {
+    oBranch = event.target;
+  } else if (event.srcElement) { // For IE
+    oBranch = event.srcElement;
+  }
+  if (!oBranch || oBranch.nodeName != "LI") return;
+  oSubBranch = getSubBranch(oBranch);
+  if (!oSubBranch) return;
+  if (oSubBranch.style.display == "block") {
+    oSubBranch.style.display = "none";
+  } else {
+    oSubBranch.style.display = "block";
+    if (oBranch.getAttribute("data-group")) loadGroup(oBranch, oSubBranch);
+  }
+}
+
+if (window.addEventListener) {
+  window.addEventListener("load", addEvents, false);
+} else if (window.attachEvent) { // For IE
+  window.attachEvent("onload", addEvents);
+}
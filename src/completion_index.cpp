@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) 2013-2016:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <algorithm>
+
+#include "ug.h"
+#include "ugbase.h"
+
+#include "registry/class_helper.h"
+#include "bridge/bridge.h"
+#include "common/util/string_util.h"
+
+#include "ugdocu_misc.h"
+#include "completion_index.h"
+
+using namespace std;
+using namespace ug;
+using namespace bridge;
+
+namespace ug
+{
+namespace DocuGen
+{
+
+class CompletionIndexEntrySort
+{
+public:
+	CompletionIndexEntrySort(const vector<CompletionIndex::Entry> &entries) : m_entries(entries) {}
+	bool operator()(size_t i, size_t j) const { return m_entries[i].name < m_entries[j].name; }
+	bool operator()(size_t i, const string &s) const { return m_entries[i].name < s; }
+private:
+	const vector<CompletionIndex::Entry> &m_entries;
+};
+
+template<typename TFunction>
+static void FillCompletionIndexEntry(CompletionIndex::Entry &e, const TFunction &thefunc, const string &group)
+{
+	stringstream ss;
+	WriteParametersOut(ss, thefunc, false);
+	e.returntype = ss.str();
+	ss.str("");
+	ss << thefunc.name() << " ";
+	WriteParametersIn(ss, thefunc, false);
+	e.signature = ss.str();
+	e.name = thefunc.name();
+	e.group = group;
+	e.tooltip = thefunc.tooltip();
+}
+
+void CompletionIndex::add_class_members(const IExportedClass *c)
+{
+	if(m_members.find(c->name()) != m_members.end()) return;
+	vector<size_t> &members = m_members[c->name()];
+
+	for(size_t i=0; i<c->num_constructors(); ++i)
+	{
+		Entry e;
+		const ExportedConstructor &ctor = c->get_constructor(i);
+		stringstream ss;
+		ss << c->name() << " ";
+		WriteParametersIn(ss, ctor, false);
+		e.type = ET_CONSTRUCTOR;
+		e.name = c->name();
+		e.owner = c->name();
+		e.group = c->group();
+		e.signature = ss.str();
+		e.tooltip = ctor.tooltip();
+		members.push_back(m_entries.size());
+		m_entries.push_back(e);
+	}
+
+	for(int bConst=0; bConst<2; bConst++)
+	{
+		size_t num = bConst ? c->num_const_methods() : c->num_methods();
+		for(size_t i=0; i<num; ++i)
+		{
+			const ExportedMethodGroup &grp = bConst ? c->get_const_method_group(i) : c->get_method_group(i);
+			for(size_t j=0; j<grp.num_overloads(); j++)
+			{
+				Entry e;
+				FillCompletionIndexEntry(e, *grp.get_overload(j), c->group());
+				e.type = ET_MEMBERFUNCTION;
+				e.owner = c->name();
+				if(bConst) e.signature.append(" const");
+				members.push_back(m_entries.size());
+				m_entries.push_back(e);
+			}
+		}
+	}
+
+	vector<string> &parents = m_parents[c->name()];
+	const vector<const char *> *pNames = c->class_names();
+	if(pNames)
+		for(size_t i=1; i<pNames->size(); i++)
+			parents.push_back(pNames->at(i));
+}
+
+void CompletionIndex::build(vector<UGDocuClassDescription> &classesAndGroupsAndImplementations)
+{
+	try{
+	Registry &reg = GetUGRegistry();
+	m_entries.clear();
+	m_sorted.clear();
+	m_members.clear();
+	m_parents.clear();
+	m_defaultClass.clear();
+
+	for(size_t i=0; i<classesAndGroupsAndImplementations.size(); i++)
+	{
+		UGDocuClassDescription &d = classesAndGroupsAndImplementations[i];
+		const IExportedClass *c = d.mp_class;
+		Entry e;
+		e.name = d.name();
+		e.group = d.group_str();
+		if(c == NULL)
+		{
+			e.type = ET_CLASSGROUP;
+			c = d.mp_group->get_default_class();
+			if(c != NULL) m_defaultClass[d.name()] = c->name();
+		}
+		else
+			e.type = ET_CLASS;
+		if(c != NULL)
+		{
+			e.signature = c->name();
+			e.tooltip = c->tooltip();
+		}
+		m_sorted.push_back(m_entries.size());
+		m_entries.push_back(e);
+	}
+
+	for(size_t i=0; i<reg.num_classes(); i++)
+		add_class_members(&reg.get_class(i));
+
+	for(size_t i=0; i<reg.num_functions(); i++)
+	{
+		ExportedFunctionGroup &fg = reg.get_function_group(i);
+		for(size_t j=0; j<fg.num_overloads(); j++)
+		{
+			Entry e;
+			FillCompletionIndexEntry(e, *fg.get_overload(j), fg.get_overload(j)->group());
+			e.type = ET_FUNCTION;
+			m_sorted.push_back(m_entries.size());
+			m_entries.push_back(e);
+		}
+	}
+
+	stable_sort(m_sorted.begin(), m_sorted.end(), CompletionIndexEntrySort(m_entries));
+	}UG_CATCH_THROW_FUNC();
+}
+
+void CompletionIndex::find_prefix(const string &prefix, vector<const Entry*> &res, size_t maxResults) const
+{
+	vector<size_t>::const_iterator it = lower_bound(m_sorted.begin(), m_sorted.end(), prefix,
+			CompletionIndexEntrySort(m_entries));
+	for(; it != m_sorted.end() && res.size() < maxResults; ++it)
+	{
+		const Entry &e = m_entries[*it];
+		if(e.name.compare(0, prefix.size(), prefix) != 0) break;
+		res.push_back(&e);
+	}
+}
+
+void CompletionIndex::find_members(const string &classname, vector<const Entry*> &res) const
+{
+	string name = classname;
+	map<string, string>::const_iterator def = m_defaultClass.find(name);
+	if(def != m_defaultClass.end()) name = def->second;
+
+	map<string, vector<size_t> >::const_iterator members = m_members.find(name);
+	if(members == m_members.end()) return;
+	for(size_t i=0; i<members->second.size(); i++)
+		res.push_back(&m_entries[members->second[i]]);
+
+	// inherited member functions, constructors are not inherited
+	map<string, vector<string> >::const_iterator parents = m_parents.find(name);
+	if(parents == m_parents.end()) return;
+	for(size_t p=0; p<parents->second.size(); p++)
+	{
+		members = m_members.find(parents->second[p]);
+		if(members == m_members.end()) continue;
+		for(size_t i=0; i<members->second.size(); i++)
+		{
+			const Entry &e = m_entries[members->second[i]];
+			if(e.type == ET_MEMBERFUNCTION) res.push_back(&e);
+		}
+	}
+}
+
+void CompletionIndex::find_signatures(const string &name, vector<const Entry*> &res) const
+{
+	size_t colon = name.find(':');
+	if(colon == string::npos)
+	{
+		vector<const Entry*> candidates;
+		find_prefix(name, candidates, m_sorted.size());
+		for(size_t i=0; i<candidates.size(); i++)
+			if(candidates[i]->name == name && candidates[i]->type == ET_FUNCTION)
+				res.push_back(candidates[i]);
+		return;
+	}
+
+	string method = name.substr(colon+1);
+	vector<const Entry*> members;
+	find_members(name.substr(0, colon), members);
+	for(size_t i=0; i<members.size(); i++)
+		if(members[i]->type == ET_MEMBERFUNCTION && members[i]->name == method)
+			res.push_back(members[i]);
+}
+
+const char *CompletionIndex::type_name(EntryType type)
+{
+	switch(type)
+	{
+		case ET_CLASS: return "class";
+		case ET_CLASSGROUP: return "classgroup";
+		case ET_FUNCTION: return "function";
+		case ET_MEMBERFUNCTION: return "memberfunction";
+		case ET_CONSTRUCTOR: return "constructor";
+	}
+	return "unknown";
+}
+
+void WriteCompletionIndexEntry(ostream &out, const CompletionIndex::Entry &e)
+{
+	out << CompletionIndex::type_name(e.type) << "\t" << e.name << "\t" << e.owner << "\t"
+		<< e.returntype << "\t" << e.signature << "\t" << e.group << "\t"
+		<< ReplaceAll(ReplaceAll(e.tooltip, "\n", " "), "\t", " ") << "\n";
+}
+
+void RunCompletionQueries(const CompletionIndex &index, istream &in, ostream &out)
+{
+	string line;
+	while(getline(in, line))
+	{
+		line = TrimString(line);
+		if(line.empty()) continue;
+		if(line == "quit") break;
+
+		size_t space = line.find(' ');
+		string request = line.substr(0, space);
+		string arg = (space == string::npos) ? string("") : TrimString(line.substr(space+1));
+
+		vector<const CompletionIndex::Entry*> res;
+		if(request == "prefix")
+			index.find_prefix(arg, res, 1000);
+		else if(request == "members")
+			index.find_members(arg, res);
+		else if(request == "signature")
+			index.find_signatures(arg, res);
+		else
+			out << "error unknown request '" << request << "'\n";
+
+		for(size_t i=0; i<res.size(); i++)
+			WriteCompletionIndexEntry(out, *res[i]);
+		out << "\n";
+		out.flush();
+	}
+}
+
+}	// namespace DocuGen
+}	// namespace ug
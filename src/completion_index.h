@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2013-2016:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __UG__COMPLETION_INDEX_H__
+#define __UG__COMPLETION_INDEX_H__
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+
+#include "bridge/bridge.h"
+#include "ug_docu_class_description.h"
+
+namespace ug
+{
+namespace DocuGen
+{
+
+/// \addtogroup apps_ugdocu
+/// \{
+
+/**
+ * \brief In-memory index of all completion entries
+ * \details Holds names, registry groups, signatures and inheritance of all
+ *   classes, classgroups, member functions and global functions, so that
+ *   prefix, member and signature queries can be answered without rereading
+ *   the completion file.
+ */
+class CompletionIndex
+{
+public:
+	enum EntryType
+	{
+		ET_CLASS,
+		ET_CLASSGROUP,
+		ET_FUNCTION,
+		ET_MEMBERFUNCTION,
+		ET_CONSTRUCTOR
+	};
+
+	class Entry
+	{
+	public:
+		EntryType type;
+		std::string name;
+		std::string owner;		///< class of member functions and constructors
+		std::string group;		///< registry group
+		std::string returntype;
+		std::string signature;
+		std::string tooltip;
+	};
+
+	void build(std::vector<UGDocuClassDescription> &classesAndGroupsAndImplementations);
+
+	/// classes, classgroups and global functions starting with prefix (at most maxResults)
+	void find_prefix(const std::string &prefix, std::vector<const Entry*> &res, size_t maxResults) const;
+	/// constructors and member functions of a class or classgroup, including inherited ones
+	void find_members(const std::string &classname, std::vector<const Entry*> &res) const;
+	/// all overloads of a global function "name" or a member function "Class:name"
+	void find_signatures(const std::string &name, std::vector<const Entry*> &res) const;
+
+	size_t num_entries() const { return m_entries.size(); }
+
+private:
+	void add_class_members(const bridge::IExportedClass *c);
+	static const char *type_name(EntryType type);
+	friend void WriteCompletionIndexEntry(std::ostream &out, const Entry &e);
+
+	std::vector<Entry> m_entries;
+	/// classes, classgroups and global functions, sorted by name
+	std::vector<size_t> m_sorted;
+	/// class name -> indices of its own constructors and member functions
+	std::map<std::string, std::vector<size_t> > m_members;
+	/// class name -> names of all its parent classes, nearest first
+	std::map<std::string, std::vector<std::string> > m_parents;
+	/// classgroup -> name of default implementation
+	std::map<std::string, std::string> m_defaultClass;
+};
+
+/// writes one query result as "type<TAB>name<TAB>owner<TAB>returntype<TAB>signature<TAB>group<TAB>tooltip"
+void WriteCompletionIndexEntry(std::ostream &out, const CompletionIndex::Entry &e);
+
+/**
+ * \brief Answers completion queries line by line until "quit" or end of input
+ * \details Requests are
+ *   - <tt>prefix <text></tt>: classes, classgroups and global functions starting with text
+ *   - <tt>members <class></tt>: constructors and member functions, including inherited ones
+ *   - <tt>signature <function></tt> or <tt>signature <class>:<method></tt>: all overloads
+ *   - <tt>quit</tt>
+ *
+ *   Each answer consists of one line per result (see WriteCompletionIndexEntry)
+ *   terminated by an empty line. Unknown requests are answered with a single
+ *   "error ..." line, also followed by an empty line.
+ */
+void RunCompletionQueries(const CompletionIndex &index, std::istream &in, std::ostream &out);
+
+// end group apps_ugdocu
+/// \}
+
+}	// namespace DocuGen
+}	// namespace ug
+
+#endif /* __UG__COMPLETION_INDEX_H__ */
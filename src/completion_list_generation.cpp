@@ -30,10 +30,13 @@
  * GNU Lesser General Public License for more details.
  */
 
+#include <atomic>
+#include <cstdio>
 #include <iostream>
 #include <sstream>
 
 #include <string>
+#include <unordered_map>
 
 #include "ug.h"
 #include "ugbase.h"
@@ -43,9 +46,18 @@
 #include "bridge/bridge.h"
 #include "common/util/parameter_parsing.h"
 #include "compile_info/compile_info.h"
+#include "common/util/file_util.h"
+#include "common/util/string_util.h"
 #include "ug_docu_class_description.h"
 #include "ugdocu_misc.h"
+#include "ugdocu_options.h"
 #include "html_generation.h"
+#include "output_file.h"
+#include "output_sink.h"
+#include "ugdocu_profiling.h"
+#include "ugdocu_parallel.h"
+#include "ugdocu_log.h"
+#include "ugdocu_filter.h"
 
 #ifdef UG_PLUGINS
 	#include "common/util/plugin_util.h"
@@ -77,7 +89,19 @@ void WriteCompletionList(std::vector<UGDocuClassDescription> classesAndGroupsAnd
 void WriteFunctionHTMLCompleter(ostream &file, const bridge::ExportedFunctionBase &thefunc,
 		const char *group, const char *pClass);
 
-void WriteClassCompleter(ostream &classhtml, UGDocuClassDescription *d, ClassHierarchy &hierarchy);
+void WriteClassCompleter(ostream &classhtml, UGDocuClassDescription *d, ClassHierarchy &hierarchy, bool bInherited=true);
+void WriteClassCompletionEntry(ostream &f, UGDocuClassDescription &d, ClassHierarchy &hierarchy, bool bReferences=false);
+
+/// directory of the completion list and shards, with trailing '/' (option completionDir)
+static string GetCompletionDir()
+{
+	string dir = GetDocuGenOptions().completionDir;
+	if(dir.empty())
+		return PathProvider::get_path(ROOT_PATH) + "/plugins/DocuGen/";
+	if(dir[dir.size()-1] != '/')
+		dir.append("/");
+	return dir;
+}
 
 
 void WriteConstructorCompleter(ostream &f, string classname, const bridge::ExportedConstructor &thefunc,
@@ -133,61 +157,80 @@ void WriteFunctionCompleter(ostream &f, const char *desc, const bridge::Exported
 	}UG_CATCH_THROW_FUNC();
 }
 
-void AddLuaDebugCompletions(ostream &f)
+/// node of the prefix trie of debug IDs, one node per dot-separated component
+class DebugIDTrieNode
+{
+public:
+	DebugIDTrieNode(size_t id, size_t end, bool bLeaf) : id(id), end(end), bLeaf(bLeaf) {}
+	size_t id;	///< index of the first debug ID which reaches this node
+	size_t end;	///< the node's full name is the first \c end characters of that ID
+	bool bLeaf;	///< created for a full debug ID (otherwise for a group)
+	/// component -> index of the child node
+	std::unordered_map<std::string, size_t> children;
+};
+
+/**
+ * Builds a prefix trie of the registered debug IDs in one pass over their
+ * characters. Nodes are stored in the order they were created, which is the order
+ * in which their groups/IDs appear first. Each node refers into the first debug
+ * ID containing it, only the components are copied as keys of the child maps,
+ * so the cost is linear in the total length of the IDs.
+ */
+void BuildDebugIDTrie(const vector<string> &s, vector<DebugIDTrieNode> &nodes)
+{
+	nodes.clear();
+	nodes.push_back(DebugIDTrieNode(0, 0, false));
+	for(size_t i=0; i<s.size(); i++)
+	{
+		const string &name = s[i];
+		size_t node = 0, begin = 0;
+		while(begin <= name.size())
+		{
+			size_t dotPos = name.find('.', begin);
+			bool bLeaf = (dotPos == string::npos);
+			size_t end = bLeaf ? name.size() : dotPos;
+
+			// find child with component name[begin, end)
+			std::pair<std::unordered_map<string, size_t>::iterator, bool> res =
+				nodes[node].children.insert(make_pair(name.substr(begin, end-begin), nodes.size()));
+			// read before push_back moves the map
+			size_t child = res.first->second;
+			if(res.second)
+				nodes.push_back(DebugIDTrieNode(i, end, bLeaf));
+			node = child;
+			begin = end+1;
+		}
+	}
+}
+
+/// writes the completion entries of the debug IDs, returns their number
+size_t AddLuaDebugCompletions(ostream &f)
 {
 	try{
 	const vector<string> &s = DebugIDManager::instance().get_registered_debug_IDs_arr();
-	std::set<string> ids;
+	vector<DebugIDTrieNode> nodes;
+	BuildDebugIDTrie(s, nodes);
 
 	f << "function\n"
 		<< "debugID.set_all_levels\n"
 		<< "none\n"
 		<< "debugID.set_all_levels(level)\n"
 		<< "Sets the debug level of all DebugIDs\n";
-	for(size_t i=0; i<s.size(); i++)
-	{
-		string name = s[i];
-		string rest = name;
-		string pre = "";
-
-		while(1)
-		{
-			int dotPos = rest.find(".");
-			if(dotPos == -1) break;
-			string sub = rest.substr(0, dotPos);
-			rest = rest.substr(dotPos+1, rest.size());
-			string luaDbgId = pre+sub;
-			if(ids.find(luaDbgId) == ids.end())
-			{
-				ids.insert(luaDbgId);
-				/*f << "function\n"
-					<< "debugID." << luaDbgId << "\n"
-					<< "none\n"
-					<< "debugID." << luaDbgId << "(level)\n"
-					<< "Sets the debug level of all DebugIDs matching<br>\"" << pre+sub << ".*\"\n";*/
-				f << "class\n"
-						<< "debugID." << luaDbgId << "\n"
-						<< "\n"
-						<< "DebugID of group " << luaDbgId << "\n" << ";\n";
-			}
-			pre = pre+sub+".";
 
-		}
-
-		//ug::bridge::SetLuaNamespace(pre+rest+".id", pre+rest);
-		if(ids.find(name) == ids.end())
-		{
-			ids.insert(name);
-			/*f << "function\n"
-				<< "debugID." << name << ".set_level\n"
-				<< "none\n"
-				<< "debugID." << name << ".set_level(level)\n"
-				<< "Sets the debug level of the DebugID<br>\"" << name << "\"\n";*/
-			f << "class\n"
-				<< "debugID." << name << "\n"
-				<< "\n"
-				<< "DebugID " << name << "\n" << ";\n";
-		}
+	// nodes are in order of first appearance, skip the root
+	for(size_t i=1; i<nodes.size(); i++)
+	{
+		const char *name = s[nodes[i].id].c_str();
+		size_t len = nodes[i].end;
+		f << "class\n" << "debugID.";
+		f.write(name, len);
+		f << "\n" << "\n";
+		if(nodes[i].bLeaf)
+			f << "DebugID ";
+		else
+			f << "DebugID of group ";
+		f.write(name, len);
+		f << "\n" << ";\n";
 	}
 	f << "function\n"
 		<< "SetDebugLevel\n"
@@ -195,6 +238,102 @@ void AddLuaDebugCompletions(ostream &f)
 		<< "SetDebugLevel(debugID, level)\n"
 		<< "Sets the debug level of the DebugID (use debugID. ...)\n";
 
+	// the two functions and one class per node except the root
+	return nodes.size() + 1;
+	}UG_CATCH_THROW_FUNC();
+	return 0;
+}
+
+/// name of the header line of a completion file
+const char *CompletionFileVersion(bool bReferences)
+{
+	return bReferences ? "UG4COMPLETER VERSION 2\n" : "UG4COMPLETER VERSION 1\n";
+}
+
+/**
+ * In version 2 of the completion format (bReferences == true) classgroups only
+ * reference their default implementation by name
+ *
+ *     classgroup
+ *     name
+ *     name of default implementation (or empty line)
+ *     html
+ *     ;
+ *
+ * and the html of a class only contains its own member functions. Inherited
+ * members have to be resolved by the consumer through the class entries named
+ * in the class hierarchy line.
+ */
+void WriteClassCompletionEntry(ostream &f, UGDocuClassDescription &d, ClassHierarchy &hierarchy, bool bReferences)
+{
+	try{
+	// d.name() returns a copy
+	TraceSpan span("completion", d.mp_class ? d.mp_class->name() : d.mp_group->name());
+	if(bReferences && d.mp_class == NULL)
+	{
+		const IExportedClass *pDefault = d.mp_group->get_default_class();
+		f << "classgroup\n" << d.name() << "\n";
+		if(pDefault != NULL) f << pDefault->name();
+		f << "\n";
+		f << "Classgroup <b>" << d.name() << "</b>";
+		if(pDefault != NULL)
+		{
+			f << ", default implementation <b>" << pDefault->name() << "</b><br>";
+			f << "Registry Group: <b>" << pDefault->group() << "</b><br>";
+			if(pDefault->tooltip().size() != 0)
+				f << pDefault->tooltip() << "<br>";
+		}
+		else
+			f << " has no default implementation.";
+		f << "\n;\n";
+		return;
+	}
+
+	// class\nclassname
+	f << "class\n" << d.name() << "\n";
+
+	// class hierachy
+	const IExportedClass *c = d.mp_class;
+	if(c == NULL)
+		c = d.mp_group->get_default_class();
+
+	// inheritance
+	if(c != NULL)
+	{
+		const vector<const char *> *pNames = c->class_names();
+		if(pNames)
+			for(vector<const char*>::const_reverse_iterator rit = pNames->rbegin(); rit < pNames->rend(); ++rit)
+				if(strcmp((*rit), c->name().c_str()) != 0)
+					f << (*rit) << " ";
+
+	}
+	f << "\n";
+
+	// html
+	WriteClassCompleter(f, &d, hierarchy, !bReferences);
+	f << "\n";
+
+	// memberfunctions
+
+	if(c != NULL)
+	{
+		for(size_t i=0; i<c->num_constructors(); ++i)
+			WriteConstructorCompleter(f, c->name(), c->get_constructor(i), c->group());
+
+		for(size_t i=0; i<c->num_methods(); ++i)
+		{
+			const ExportedMethodGroup &grp = c->get_method_group(i);
+			for(size_t j=0; j<grp.num_overloads(); j++)
+				WriteFunctionCompleter(f, "memberfunction", *grp.get_overload(j), c->group(), c->name().c_str());
+		}
+		for(size_t i=0; i<c->num_const_methods(); ++i)
+		{
+			const ExportedMethodGroup &grp = c->get_const_method_group(i);
+			for(size_t j=0; j<grp.num_overloads(); j++)
+				WriteFunctionCompleter(f, "memberfunction", *grp.get_overload(j), c->group(), c->name().c_str(), true);
+		}
+	}
+	f << ";\n";
 	}UG_CATCH_THROW_FUNC();
 }
 
@@ -240,82 +379,328 @@ void WriteCompletionList(std::vector<UGDocuClassDescription> &classesAndGroupsAn
 	returntype
 	signature
 	html
+
+	for version 2 (option completionReferences) see WriteClassCompletionEntry.
 */
 
-	std::string ug4CompletionFile = PathProvider::get_path(ROOT_PATH) + "/plugins/DocuGen/myUg4CompletionList.txt";
+	const DocuGenFilter &filter = GetDocuGenFilter();
+	// a filtered list must not replace the complete one
+	std::string ug4CompletionFile = GetCompletionDir()
+			+ (filter.is_active() ? "myUg4CompletionList_filtered.txt" : "myUg4CompletionList.txt");
 	Registry &reg = GetUGRegistry();
-	fstream f(ug4CompletionFile.c_str(), ios::out);
+	OutputFile f(ug4CompletionFile);
 	UG_LOG("Writing completion info to " << ug4CompletionFile << " ...\n");
-	f << "UG4COMPLETER VERSION 1\n";
-	for(size_t i=0; i<classesAndGroupsAndImplementations.size(); i++)
+	bool bReferences = GetDocuGenOptions().completionReferences;
+	f << CompletionFileVersion(bReferences);
 	{
-		//cout << classesAndGroupsAndImplementations[i].name() << "\n";
-		// class\nclassname
-		f << "class\n" << classesAndGroupsAndImplementations[i].name() << "\n";
-
-		// class hierachy
-		const IExportedClass *c = classesAndGroupsAndImplementations[i].mp_class;
-		if(c == NULL)
-			c = classesAndGroupsAndImplementations[i].mp_group->get_default_class();
-
-		// inheritance
-		if(c != NULL)
+		PhaseTimer phase("classes");
+		ProgressCounter progress("completion classes", classesAndGroupsAndImplementations.size());
+		size_t numClasses = 0;
+		for(size_t i=0; i<classesAndGroupsAndImplementations.size(); i++)
 		{
-			const vector<const char *> *pNames = c->class_names();
-			if(pNames)
-				for(vector<const char*>::const_reverse_iterator rit = pNames->rbegin(); rit < pNames->rend(); ++rit)
-					if(strcmp((*rit), c->name().c_str()) != 0)
-						f << (*rit) << " ";
+			if(filter.description_selected(classesAndGroupsAndImplementations[i]))
+			{
+				WriteClassCompletionEntry(f, classesAndGroupsAndImplementations[i], hierarchy, bReferences);
+				numClasses++;
+			}
+			progress.step();
+		}
+		UG_LOG("Wrote " << numClasses << " classes/classgroups.\n");
+	}
 
+	{
+		PhaseTimer phase("global functions");
+		size_t numFunctions = 0;
+		for(size_t i=0; i<reg.num_functions(); i++)
+		{
+			ExportedFunctionGroup &fg = reg.get_function_group(i);
+			TraceSpan span("completion", fg.name());
+			for(size_t j=0; j<fg.num_overloads(); j++)
+				if(filter.function_selected(fg.get_overload(j)))
+				{
+					WriteFunctionCompleter(f, "function", *fg.get_overload(j), fg.get_overload(j)->group(), NULL, false);
+					numFunctions++;
+				}
 		}
-		f << "\n";
+		UG_LOG("Wrote " << numFunctions << " global functions.\n");
+		UG_LOG("done!\n");
+	}
 
-		// html
-		WriteClassCompleter(f, &classesAndGroupsAndImplementations[i], hierarchy);
-		f << "\n";
 
-		// memberfunctions
+	{
+		PhaseTimer phase("debug IDs");
+		AddLuaDebugCompletions(f);
+	}
+	f.close();
+
 
-		if(c != NULL)
+	// a tar stream on stdout can't take messages
+	if(bSilent && !GetOutputSink().writes_to_stdout())
+	{
+		GetLogAssistant().enable_terminal_output(true);
+		cout << "Wrote ug4 completion file to " << ug4CompletionFile << ", " << classesAndGroupsAndImplementations.size() << " classes/classgroups, " << reg.num_functions() << " global functions.\n";
+		GetLogAssistant().enable_terminal_output(false);
+	}
+
+	}UG_CATCH_THROW_FUNC();
+}
+
+/// name of the completion shard for entries of registry group \p group
+/**
+ * All groups of a plugin share one shard "plugin.<name>", every other
+ * registry group gets a shard of its own.
+ */
+string GetCompletionShardName(string group)
+{
+	if(IsPluginGroup(group))
+	{
+		group = group.substr(9);
+		size_t slash = group.find('/');
+		if(slash != string::npos)
+			group.resize(slash);
+		group = string("plugin.") + group;
+	}
+	group = TrimString(group);
+	if(group.empty()) return "nogroup";
+	group = ReplaceAll(group, "/", ".");
+	return ReplaceAll(group, " ", "_");
+}
+
+class CompletionShard
+{
+public:
+	CompletionShard() : numEntries(0) {}
+	string content;
+	size_t numEntries;
+	string hash;
+};
+
+/// reads name -> hash (and optionally name -> line) of a previously written manifest.txt
+void ReadCompletionManifest(const string &filename, map<string, string> &hashes, map<string, string> *lines = NULL)
+{
+	ifstream f(filename.c_str());
+	string line;
+	while(getline(f, line))
+	{
+		vector<string> cols;
+		TokenizeString(line, cols, '\t');
+		if(cols.size() == 4 || cols.size() == 5)
 		{
-			for(size_t i=0; i<c->num_constructors(); ++i)
-				WriteConstructorCompleter(f, c->name(), c->get_constructor(i), c->group());
+			hashes[cols[0]] = cols[3];
+			if(lines) (*lines)[cols[0]] = line;
+		}
+	}
+}
 
-			for(size_t i=0; i<c->num_methods(); ++i)
-			{
-				const ExportedMethodGroup &grp = c->get_method_group(i);
-				for(size_t j=0; j<grp.num_overloads(); j++)
-					WriteFunctionCompleter(f, "memberfunction", *grp.get_overload(j), c->group(), c->name().c_str());
-			}
-			for(size_t i=0; i<c->num_const_methods(); ++i)
-			{
-				const ExportedMethodGroup &grp = c->get_const_method_group(i);
-				for(size_t j=0; j<grp.num_overloads(); j++)
-					WriteFunctionCompleter(f, "memberfunction", *grp.get_overload(j), c->group(), c->name().c_str(), true);
-			}
+/// DistributedParallelFor body rendering and writing one shard
+class CompletionShardBody
+{
+public:
+	CompletionShardBody(std::vector<UGDocuClassDescription> &classes, ClassHierarchy &hierarchy,
+			const string &completionDir, bool bReferences, const map<string, string> &oldHashes)
+		: m_classes(classes), m_hierarchy(hierarchy), m_completionDir(completionDir),
+		  m_bReferences(bReferences), m_oldHashes(oldHashes), m_numWritten(0) {}
+
+	void operator()(size_t i, size_t thread)
+	{
+		CompletionShard &shard = shards[i];
+		TraceSpan span("completion", names[i]);
+		stringstream ss;
+		ss << CompletionFileVersion(m_bReferences);
+		for(size_t j=0; j<classItems[i].size(); j++)
+			WriteClassCompletionEntry(ss, m_classes[classItems[i][j]], m_hierarchy, m_bReferences);
+		for(size_t j=0; j<functionItems[i].size(); j++)
+		{
+			const ExportedFunction &func = *functionItems[i][j];
+			WriteFunctionCompleter(ss, "function", func, func.group(), NULL, false);
+		}
+		// content may already hold the debug IDs
+		shard.content = ss.str() + shard.content;
+
+		shard.hash = ContentHashToString(ContentHash(shard.content));
+		string path = m_completionDir + names[i] + ".txt";
+		map<string, string>::const_iterator old = m_oldHashes.find(names[i]);
+		if(old == m_oldHashes.end() || old->second != shard.hash || !OutputFileExists(path)
+				|| NeedsGzipSidecar(path, shard.content.size()))
+		{
+			WriteOutputFile(path, shard.content);
+			m_numWritten++;
 		}
-		f << ";\n";
 	}
-	UG_LOG("Wrote " << classesAndGroupsAndImplementations.size() << " classes/classgroups.\n");
 
+	size_t num_written() const { return m_numWritten; }
+
+	/// shard names in manifest order, entries and contents of every shard
+	vector<string> names;
+	vector<CompletionShard> shards;
+	vector<vector<size_t> > classItems;
+	vector<vector<const ExportedFunction*> > functionItems;
+
+private:
+	std::vector<UGDocuClassDescription> &m_classes;
+	ClassHierarchy &m_hierarchy;
+	string m_completionDir;
+	bool m_bReferences;
+	const map<string, string> &m_oldHashes;
+	std::atomic<size_t> m_numWritten;
+};
+
+/**
+ * Same content as WriteCompletionList, but split into one file per registry group
+ * or plugin (see GetCompletionShardName) in the subdirectory completion of GetCompletionDir().
+ * The manifest.txt there lists one shard per line as
+ *
+ *     name <TAB> filename <TAB> number of entries <TAB> content hash
+ *
+ * With the option gzip, a fifth column holds the size of the compressed
+ * sidecar filename.gz (0 for shards below gzipMinSize).
+ * Shards whose hash matches the previous manifest are not rewritten. The
+ * shards are rendered and written in parallel (option threads) and, if
+ * running on several processes, partitioned among them. Each process then
+ * writes the hashes of its shards to manifest.<rank>.txt, which the output
+ * rank merges into the manifest.
+ */
+void WriteCompletionShards(std::vector<UGDocuClassDescription> &classesAndGroupsAndImplementations, bool bSilent, ClassHierarchy &hierarchy)
+{
+	try{
+	string completionDir = GetCompletionDir() + "completion/";
+	if(IsOutputRank() && !DirectoryExists(completionDir.c_str()))
+		CreateDirectory(completionDir);
+	size_t numRanks = GetDocuGenNumRanks();
+	UG_LOG("Writing completion shards to " << completionDir << " ...\n");
+
+	Registry &reg = GetUGRegistry();
+	bool bReferences = GetDocuGenOptions().completionReferences;
+
+	string manifestFile = completionDir + "manifest.txt";
+	map<string, string> oldHashes, oldLines;
+	ReadCompletionManifest(manifestFile, oldHashes, &oldLines);
+	// the old manifest has to be read by all processes before it is replaced
+	SynchronizeDocuGenRanks();
+
+	// collect the shard names, the manifest lists them sorted
+	const DocuGenFilter &filter = GetDocuGenFilter();
+	map<string, size_t> shardIndex;
+	for(size_t i=0; i<classesAndGroupsAndImplementations.size(); i++)
+		if(filter.description_selected(classesAndGroupsAndImplementations[i]))
+			shardIndex[GetCompletionShardName(classesAndGroupsAndImplementations[i].group_str())] = 0;
 	for(size_t i=0; i<reg.num_functions(); i++)
 	{
 		ExportedFunctionGroup &fg = reg.get_function_group(i);
 		for(size_t j=0; j<fg.num_overloads(); j++)
-			WriteFunctionCompleter(f, "function", *fg.get_overload(j), fg.get_overload(j)->group(), NULL, false);
+			if(filter.function_selected(fg.get_overload(j)))
+				shardIndex[GetCompletionShardName(fg.get_overload(j)->group())] = 0;
 	}
-	UG_LOG("Wrote " << reg.num_functions() << " global functions.\n");
-	UG_LOG("done!\n");
+	shardIndex["debugID"] = 0;
 
+	CompletionShardBody body(classesAndGroupsAndImplementations, hierarchy, completionDir, bReferences, oldHashes);
+	for(map<string, size_t>::iterator it = shardIndex.begin(); it != shardIndex.end(); ++it)
+	{
+		it->second = body.names.size();
+		body.names.push_back(it->first);
+	}
+	body.shards.resize(body.names.size());
+	body.classItems.resize(body.names.size());
+	body.functionItems.resize(body.names.size());
+
+	// assign the entries to the shards, keeping their order
+	for(size_t i=0; i<classesAndGroupsAndImplementations.size(); i++)
+	{
+		if(!filter.description_selected(classesAndGroupsAndImplementations[i])) continue;
+		size_t shard = shardIndex[GetCompletionShardName(classesAndGroupsAndImplementations[i].group_str())];
+		body.classItems[shard].push_back(i);
+		body.shards[shard].numEntries++;
+	}
+	for(size_t i=0; i<reg.num_functions(); i++)
+	{
+		ExportedFunctionGroup &fg = reg.get_function_group(i);
+		for(size_t j=0; j<fg.num_overloads(); j++)
+		{
+			if(!filter.function_selected(fg.get_overload(j))) continue;
+			size_t shard = shardIndex[GetCompletionShardName(fg.get_overload(j)->group())];
+			body.functionItems[shard].push_back(fg.get_overload(j));
+			body.shards[shard].numEntries++;
+		}
+	}
 
+	// the debug IDs are collected in this thread, DebugIDManager is not thread safe
+	{
+		stringstream ss;
+		CompletionShard &shard = body.shards[shardIndex["debugID"]];
+		shard.numEntries += AddLuaDebugCompletions(ss);
+		shard.content = ss.str();
+	}
 
-	AddLuaDebugCompletions(f);
+	DistributedParallelFor(body.names.size(), body);
 
+	if(numRanks > 1)
+	{
+		if(!IsOutputRank())
+		{
+			stringstream partialFile;
+			partialFile << completionDir << "manifest." << GetDocuGenRank() << ".txt";
+			OutputFile partial(partialFile.str());
+			for(size_t i=0; i<body.names.size(); i++)
+				if(IsLocalItem(i))
+					partial << body.names[i] << "\t" << body.names[i] << ".txt\t" << body.shards[i].numEntries << "\t" << body.shards[i].hash << "\n";
+		}
+		SynchronizeDocuGenRanks();
+		if(!IsOutputRank())
+		{
+			UG_LOG("Wrote " << body.num_written() << " of " << NumLocalItems(body.names.size()) << " local completion shards.\n");
+			return;
+		}
+		for(size_t rank=1; rank<numRanks; rank++)
+		{
+			stringstream partialFile;
+			partialFile << completionDir << "manifest." << rank << ".txt";
+			map<string, string> hashes;
+			ReadCompletionManifest(partialFile.str(), hashes);
+			for(size_t i=0; i<body.names.size(); i++)
+				if(hashes.count(body.names[i]))
+					body.shards[i].hash = hashes[body.names[i]];
+			remove(partialFile.str().c_str());
+		}
+	}
 
-	if(bSilent)
+	// with a filter, the shards of the other groups stay as they are,
+	// otherwise the shards of groups which disappeared are removed
+	map<string, string> manifestLines;
+	if(filter.is_active())
+		manifestLines = oldLines;
+	else if(GetOutputSink().is_file_system())
+	{
+		for(map<string, string>::iterator it = oldLines.begin(); it != oldLines.end(); ++it)
+		{
+			if(shardIndex.count(it->first)) continue;
+			string stale = completionDir + it->first + ".txt";
+			remove(stale.c_str());
+			remove((stale + ".gz").c_str());
+		}
+	}
+	for(size_t i=0; i<body.names.size(); i++)
+	{
+		stringstream line;
+		line << body.names[i] << "\t" << body.names[i] << ".txt\t" << body.shards[i].numEntries << "\t" << body.shards[i].hash;
+		// the sidecars of all ranks are on the shared file system
+		if(GetDocuGenOptions().gzip)
+			line << "\t" << CompressedFileSize(completionDir + body.names[i] + ".txt");
+		manifestLines[body.names[i]] = line.str();
+	}
+	OutputFile manifest(manifestFile);
+	manifest << "UG4COMPLETER MANIFEST VERSION 1\n";
+	for(map<string, string>::iterator it = manifestLines.begin(); it != manifestLines.end(); ++it)
+		manifest << it->second << "\n";
+	size_t numWritten = body.num_written();
+	size_t numLocal = NumLocalItems(body.names.size());
+	UG_LOG("Wrote " << numWritten << " of " << numLocal << " completion shards, "
+			<< numLocal-numWritten << " unchanged.\n");
+
+	// a tar stream on stdout can't take messages
+	if(bSilent && !GetOutputSink().writes_to_stdout())
 	{
 		GetLogAssistant().enable_terminal_output(true);
-		cout << "Wrote ug4 completion file to " << ug4CompletionFile << ", " << classesAndGroupsAndImplementations.size() << " classes/classgroups, " << reg.num_functions() << " global functions.\n";
+		cout << "Wrote ug4 completion shards to " << completionDir << ", " << numWritten << " of " << body.names.size() << " shards changed.\n";
 		GetLogAssistant().enable_terminal_output(false);
 	}
 
@@ -348,7 +733,11 @@ void WriteFunctionHTMLCompleter(ostream &file, const bridge::ExportedFunctionBas
 }
 
 
-void WriteClassCompleter(ostream &classhtml, UGDocuClassDescription *d, ClassHierarchy &hierarchy)
+/**
+ * \param bInherited if false, the member functions of parent classes are not
+ *   repeated, only the inheritance line links to them.
+ */
+void WriteClassCompleter(ostream &classhtml, UGDocuClassDescription *d, ClassHierarchy &hierarchy, bool bInherited)
 {
 	try{
 	Registry &reg = GetUGRegistry();
@@ -392,7 +781,7 @@ void WriteClassCompleter(ostream &classhtml, UGDocuClassDescription *d, ClassHie
 	// print member functions
 	classhtml 	<< "<table>";
 	PrintClassFunctionsHMTL(classhtml, pC, false);
-	if(pNames)
+	if(pNames && bInherited)
 	{
 		// print inherited member functions
 		for(size_t i=1; i<pNames->size(); i++)
@@ -31,6 +31,10 @@
  */
 
 #include "cpp_generator.h"
+#include "ugdocu_profiling.h"
+#include "ugdocu_parallel.h"
+#include "ugdocu_log.h"
+#include "ugdocu_filter.h"
 
 #include "registry/class_helper.h"
 #ifdef UG_BRIDGE
@@ -42,7 +46,7 @@
 #include "common/assert.h"
 #include "common/error.h"
 
-#include <iostream>	// std::fstream
+#include <iostream>	// std::endl
 #include <sstream>	// std::stringstream
 #include <boost/algorithm/string.hpp>	// boost::replace_all, boost::split, boost::to_lower, boost::trim
 
@@ -90,76 +94,188 @@ CppGenerator::~CppGenerator()
 	if ( m_curr_file.is_open() ) m_curr_file.close();
 }
 
+/// DistributedParallelFor body, every thread writes with its own generator
+class CppGenerator::ClassGroupBody
+{
+	public:
+		ClassGroupBody( vector<CppGenerator*> &generators, 
+		                const vector<bridge::ClassGroupDesc*> &class_groups,
+		                ProgressCounter &progress ) :
+			  m_generators( generators )
+			, m_class_groups( class_groups )
+			, m_progress( progress )
+		{}
+		
+		void operator()( size_t i, size_t thread )
+		{
+			CppGenerator &gen = *m_generators[thread];
+			gen.m_curr_group = m_class_groups[i];
+			gen.generate_class_group();
+			m_progress.step();
+		}
+		
+	private:
+		vector<CppGenerator*> &m_generators;
+		const vector<bridge::ClassGroupDesc*> &m_class_groups;
+		ProgressCounter &m_progress;
+};
+
+/// DistributedParallelFor body, every thread writes with its own generator
+class CppGenerator::UngroupedClassBody
+{
+	public:
+		UngroupedClassBody( vector<CppGenerator*> &generators, 
+		                    const vector<bridge::IExportedClass*> &classes,
+		                    const vector<string> &file_names,
+		                    ProgressCounter &progress ) :
+			  m_generators( generators )
+			, m_classes( classes )
+			, m_file_names( file_names )
+			, m_progress( progress )
+		{}
+		
+		void operator()( size_t i, size_t thread )
+		{
+			m_generators[thread]->generate_ungrouped_class( m_classes[i], m_file_names[i] );
+			m_progress.step();
+		}
+		
+	private:
+		vector<CppGenerator*> &m_generators;
+		const vector<bridge::IExportedClass*> &m_classes;
+		const vector<string> &m_file_names;
+		ProgressCounter &m_progress;
+};
+
 void CppGenerator::generate_cpp_files()
 {
 	try{
-	UG_LOG( "Generating CPP files for " << mr_reg.num_class_groups() << " class groups ..." << endl );
+	// the first generator is this one, every further worker thread gets its own
+	size_t num_threads = GetNumWorkerThreads();
+	vector<SmartPtr<CppGenerator> > workers;
+	vector<CppGenerator*> generators( 1, this );
+	for ( size_t thread = 1; thread < num_threads; ++thread ) {
+		workers.push_back( make_sp( new CppGenerator( m_output_dir, mr_chp, m_silent ) ) );
+		generators.push_back( workers.back().get() );
+	}
+	
+	const DocuGenFilter &filter = GetDocuGenFilter();
+	
+	{
+	PhaseTimer phase( "class groups" );
+	vector<bridge::ClassGroupDesc*> class_groups;
 	for ( size_t i_class_group = 0; i_class_group < mr_reg.num_class_groups(); ++i_class_group ) {
-		m_curr_group = mr_reg.get_class_group( i_class_group );
-		generate_class_group();
+		if ( filter.class_group_selected( mr_reg.get_class_group( i_class_group ) ) ) {
+			class_groups.push_back( mr_reg.get_class_group( i_class_group ) );
+		}
+	}
+	UG_LOG( "Generating CPP files for " << class_groups.size() << " class groups ..." << endl );
+	ProgressCounter progress( "class groups", NumLocalItems( class_groups.size() ) );
+	ClassGroupBody body( generators, class_groups, progress );
+	DistributedParallelFor( class_groups.size(), body );
+	for ( size_t thread = 1; thread < generators.size(); ++thread ) {
+		m_written_classes.insert( generators[thread]->m_written_classes.begin(), 
+		                          generators[thread]->m_written_classes.end() );
+	}
+	// the default classes of groups written by other processes count as written, too
+	for ( size_t i = 0; i < class_groups.size(); ++i ) {
+		if ( IsLocalItem( i ) ) continue;
+		bridge::ClassGroupDesc *group = class_groups[i];
+		string group_id = name_to_id( group->name() );
+		if ( group_id.empty() || group->get_default_class() == NULL ) continue;
+		m_written_classes.insert( make_pair( mr_chp.get_group( group->get_default_class()->name() ),
+		                                     string( m_output_dir ).append( group_id ).append( ".cpp" ) ) );
+	}
 	}
 	
+	{
+	PhaseTimer phase( "ungrouped classes" );
 	UG_LOG( "Generating CPP files for ungrouped classes ..." << endl );
-	size_t count_new_classes = 0;
+	// select the classes first, a class group is written only once
+	vector<bridge::IExportedClass*> new_classes;
+	vector<string> file_names;
 	for ( size_t i_class = 0; i_class < mr_reg.num_classes(); ++i_class ) {
-		m_curr_class = mr_reg.get_class( mr_reg.get_class( i_class ).name() );
-		string trimmed_class_name = mr_chp.get_group( m_curr_class->name() );
+		bridge::IExportedClass *cls = mr_reg.get_class( mr_reg.get_class( i_class ).name() );
+		if ( !filter.class_selected( cls ) ) continue;
+		string trimmed_class_name = mr_chp.get_group( cls->name() );
 		if ( m_written_classes.count( trimmed_class_name ) == 0 ) {
-			string class_id = name_to_id( trimmed_class_name );
-			string file_name = string( m_output_dir ).append( class_id ).append( ".cpp" );
-			m_curr_file.open( file_name.c_str(), ios::out );
-			
-			m_curr_group_name = string( "ug::" ).append( trimmed_class_name );
-			if ( !m_silent ) {
-				UG_LOG( "  Writing class " << trimmed_class_name << " to '" 
-				        << file_name << "'." << endl );
-			}
-
-			// setup namespace hierarchy
-			string namespace_group_closing = write_group_namespaces( split_group_hieararchy( m_curr_class->group() ) );
-
-			generate_class_docu();
-			generate_class_cpp();
-			
-			m_curr_file << namespace_group_closing;
-			
+			string file_name = string( m_output_dir ).append( name_to_id( trimmed_class_name ) ).append( ".cpp" );
 			m_written_classes.insert( make_pair( trimmed_class_name, file_name ) );
-			m_curr_group_name = "";
-			m_curr_file.close();
-			++count_new_classes;
+			new_classes.push_back( cls );
+			file_names.push_back( file_name );
 		} else {
 			if ( !m_silent ) {
-				UG_LOG( "  Class '" << trimmed_class_name << "' already written to '" 
-				        << m_written_classes.at( trimmed_class_name ) << "'." << endl );
+				DOCUGEN_LOG( LL_VERBOSE, "  Class '" << trimmed_class_name << "' already written to '" 
+				             << m_written_classes.at( trimmed_class_name ) << "'." << endl );
 			}
 		}
 	}
-	UG_LOG( count_new_classes << " additional classes written." << endl );
+	{
+		ProgressCounter progress( "ungrouped classes", NumLocalItems( new_classes.size() ) );
+		UngroupedClassBody body( generators, new_classes, file_names, progress );
+		DistributedParallelFor( new_classes.size(), body );
+	}
+	UG_LOG( NumLocalItems( new_classes.size() ) << " additional classes written." << endl );
+	}
+	
+	// files existing only once are written by the output rank
+	if ( !IsOutputRank() ) return;
 	
+	{
+	PhaseTimer phase( "global functions" );
 	UG_LOG( "Generating CPP for " << mr_reg.num_functions() << " global functions ..." << endl );
 	generate_global_functions();
+	}
 	
 	UG_LOG( "Writing Doxygen group definitions ..." << endl );
 	write_group_definitions();
 	}UG_CATCH_THROW_FUNC();
 }
 
+void CppGenerator::generate_ungrouped_class( bridge::IExportedClass *cls, const string &file_name )
+{
+	try{
+	m_curr_class = cls;
+	string trimmed_class_name = mr_chp.get_group( m_curr_class->name() );
+	TraceSpan span( "CppGenerator", trimmed_class_name );
+	m_curr_file.open( file_name );
+	
+	m_curr_group_name = string( "ug::" ).append( trimmed_class_name );
+	if ( !m_silent ) {
+		DOCUGEN_LOG( LL_VERBOSE, "  Writing class " << trimmed_class_name << " to '" 
+		             << file_name << "'." << endl );
+	}
+
+	// setup namespace hierarchy
+	string namespace_group_closing = write_group_namespaces( split_group_hieararchy( m_curr_class->group() ) );
+
+	generate_class_docu();
+	generate_class_cpp();
+	
+	m_curr_file << namespace_group_closing;
+	
+	m_curr_group_name = "";
+	m_curr_file.close();
+	}UG_CATCH_THROW_FUNC();
+}
+
 void CppGenerator::generate_class_group()
 {
 	try{
+	TraceSpan span( "CppGenerator", m_curr_group->name() );
 	m_curr_group_name = string( "ug::" ).append( m_curr_group->name() );
 	string group_id = name_to_id( m_curr_group->name() );
 	
 	if ( group_id.empty() ) {
-		UG_WARNING( "Empty group_id for group_name '" << m_curr_group_name << "'" << endl );
+		DOCUGEN_WARNING( "Empty group_id for group_name '" << m_curr_group_name << "'" << endl );
 		return;
 	}
 	
 	string file_name = string( m_output_dir ).append( group_id ).append( ".cpp" );
 	if ( !m_silent ) {
-		UG_LOG( "  Writing group '" << m_curr_group_name << "' to " << file_name << endl );
+		DOCUGEN_LOG( LL_VERBOSE, "  Writing group '" << m_curr_group_name << "' to " << file_name << endl );
 	}
-	m_curr_file.open( file_name.c_str(), ios::out );
+	m_curr_file.open( file_name );
 	
 	// we only consider the default class
 	m_curr_class = m_curr_group->get_default_class();
@@ -193,13 +309,15 @@ void CppGenerator::generate_global_functions()
 {
 	try{
 	string file_name = string( m_output_dir ).append( "global_functions.cpp" );
-	UG_LOG( "Writing global functions to " << file_name << endl );
-	m_curr_file.open( file_name.c_str(), ios::out );
+	DOCUGEN_LOG( LL_VERBOSE, "Writing global functions to " << file_name << endl );
+	m_curr_file.open( file_name );
 	
 	m_is_global = true;
 	
+	const DocuGenFilter &filter = GetDocuGenFilter();
 	string namespace_group_closing;
 	for ( size_t i_global_function = 0; i_global_function < mr_reg.num_functions(); ++i_global_function ) {
+		if ( !filter.function_selected( &mr_reg.get_function( i_global_function ) ) ) continue;
 		bridge::ExportedFunction curr_func = mr_reg.get_function( i_global_function );
 		
 		// setup namespace and groups hierarchy
@@ -222,7 +340,7 @@ void CppGenerator::generate_global_functions()
 void CppGenerator::write_group_definitions()
 {
 	try{
-	m_curr_file.open( string( m_output_dir ).append( "regdocu.doxygen" ).c_str(), ios::out );
+	m_curr_file.open( string( m_output_dir ).append( "regdocu.doxygen" ) );
 	
 	m_curr_file << Doxygen::BRIEF << "This namespace holds documentation for all registered functions and classes of libug4." << endl
 	            << "namespace ug4Bridge {" << endl
@@ -250,7 +368,7 @@ void CppGenerator::generate_class_docu()
 			            << "Special compile-time parameters are required for this." << endl;
 		}
 	} else {
-		UG_WARNING( "File not open." );
+		DOCUGEN_WARNING( "File not open." );
 	}
 
 	}UG_CATCH_THROW_FUNC();
@@ -271,7 +389,7 @@ void CppGenerator::generate_class_cpp()
 		generate_class_public_members();
 		m_curr_file << "};" << endl;
 	} else {
-		UG_WARNING( "File not open." );
+		DOCUGEN_WARNING( "File not open." );
 	}
 
 	}UG_CATCH_THROW_FUNC();
@@ -406,6 +524,12 @@ string CppGenerator::generate_parameter_list( const TFunction &func )
 	}UG_CATCH_THROW_FUNC(); return "";
 }
 
+#ifdef UG_DOCUGEN_BENCHMARK
+// instantiated for CppGeneratorMicrobenchmark
+template string CppGenerator::generate_parameter_list( const bridge::ExportedFunctionBase &func );
+template string CppGenerator::generate_parameter_list( const bridge::ExportedConstructor &func );
+#endif
+
 string CppGenerator::generate_return_value( const bridge::ExportedFunctionBase &method )
 {
 	try{
@@ -419,7 +543,7 @@ string CppGenerator::generate_return_value( const bridge::ExportedFunctionBase &
 	} else if ( param_out.size() > 1 ) {
 		// more than one return value
 		//TODO implement handling of multiple return values
-		UG_WARNING( "Multiple return values not yet implemented in C++Generator."
+		DOCUGEN_WARNING( "Multiple return values not yet implemented in C++Generator."
 		            << " Displaying as '()'." );
 		return "()";
 	} else {
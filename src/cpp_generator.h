@@ -44,6 +44,7 @@
 #include "registry/registry.h"
 #include "registry/class_helper.h"
 #include "class_hierarchy_provider.h"
+#include "output_file.h"
 
 namespace ug
 {
@@ -82,6 +83,9 @@ class CppGenerator
 		void generate_cpp_files();
 		
 	private:
+		/// measures the parameter rendering (see microbenchmark.cpp)
+		friend class CppGeneratorMicrobenchmark;
+		
 		/// \{
 		/**
 		 * \brief Generates C++ files for all classes in class groups
@@ -99,8 +103,18 @@ class CppGenerator
 		 *   documentation and declaration to the file `global_functions.cpp`.
 		 */
 		void generate_global_functions();
+		/**
+		 * \brief Generates the C++ file for a class which is not in a class group
+		 * \param cls       the class
+		 * \param file_name name and path of the file to write
+		 */
+		void generate_ungrouped_class( bridge::IExportedClass *cls, const string &file_name );
 		/// \}
 		
+		/// \brief ParallelFor bodies of generate_cpp_files()
+		class ClassGroupBody;
+		class UngroupedClassBody;
+		
 		/// \{
 		/**
 		 * \brief Writes documentation for current class to current file
@@ -308,7 +322,7 @@ class CppGenerator
 		map<string, string> m_written_classes;
 		
 		/// \brief Current file stream to write to
-		fstream m_curr_file;
+		OutputFile m_curr_file;
 		
 		bool m_silent;
 };
@@ -0,0 +1,576 @@
+/*
+ * Copyright (c) 2013-2016:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+
+#include <cctype>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+	#define UG_DOCUGEN_SOCKETS
+	#include <arpa/inet.h>
+	#include <netinet/in.h>
+	#include <sys/socket.h>
+	#include <sys/stat.h>
+	#include <sys/time.h>
+	#include <sys/un.h>
+	#include <unistd.h>
+#endif
+
+#include "common/log.h"
+#include "common/error.h"
+#include "common/util/string_util.h"
+#include "registry/class_helper.h"
+
+#include "ugdocu_misc.h"
+#include "ugdocu_log.h"
+#include "ugdocu_filter.h"
+#include "output_sink.h"
+#include "html_generation.h"
+#include "search_index.h"
+#include "docu_server.h"
+
+using namespace std;
+
+namespace ug
+{
+namespace DocuGen
+{
+
+using namespace bridge;
+
+void GetGroups(std::map<string, UGRegistryGroup> &g);
+
+PageCache::PageCache(size_t capacity) : m_capacity(capacity > 0 ? capacity : 1)
+{
+}
+
+bool PageCache::get(const string &name, string &content)
+{
+	map<string, PageList::iterator>::iterator it = m_index.find(name);
+	if(it == m_index.end()) return false;
+	m_pages.splice(m_pages.begin(), m_pages, it->second);
+	content = it->second->second;
+	return true;
+}
+
+void PageCache::put(const string &name, const string &content)
+{
+	map<string, PageList::iterator>::iterator it = m_index.find(name);
+	if(it != m_index.end())
+	{
+		it->second->second = content;
+		m_pages.splice(m_pages.begin(), m_pages, it->second);
+		return;
+	}
+	if(m_index.size() >= m_capacity)
+	{
+		m_index.erase(m_pages.back().first);
+		m_pages.pop_back();
+	}
+	m_pages.push_front(make_pair(name, content));
+	m_index[name] = m_pages.begin();
+}
+
+
+/// collects the files written while a page is rendered instead of writing them
+class CaptureSink : public OutputSink
+{
+public:
+	virtual void write(const string &filename, const char *data, size_t size)
+	{
+		lock_guard<mutex> lock(m_mutex);
+		files[filename].assign(data, size);
+	}
+
+	virtual void write_from_file(const string &filename, const string &tmpFilename, size_t size)
+	{
+		string content(size, '\0');
+		{
+			ifstream in(tmpFilename.c_str(), ios::binary);
+			if(size > 0 && !in.read(&content[0], size))
+				UG_THROW("could not read '" << tmpFilename << "'.");
+		}
+		remove(tmpFilename.c_str());
+		write(filename, content.data(), content.size());
+	}
+
+	virtual bool keeps_files_in_memory() const { return true; }
+
+	/// filename -> content
+	std::map<string, string> files;
+
+private:
+	mutex m_mutex;
+};
+
+/// directs the output into a sink while it exists
+class ScopedOutputSink
+{
+public:
+	ScopedOutputSink(OutputSink &sink) { SetOutputSink(&sink); }
+	~ScopedOutputSink() { SetOutputSink(NULL); }
+};
+
+
+/// renders the pages of the HTML docu on request, see ServeHTMLDocu
+class DocuServer
+{
+public:
+	DocuServer(std::vector<UGDocuClassDescription> &classes, std::vector<UGDocuClassDescription> &classesAndGroups,
+			ClassHierarchy &hierarchy, size_t cacheSize)
+		: m_classes(classes), m_hierarchy(hierarchy), m_cache(cacheSize)
+	{
+		const DocuGenFilter &filter = GetDocuGenFilter();
+		for(size_t i=0; i<classesAndGroups.size(); i++)
+			if(filter.description_selected(classesAndGroups[i]))
+				m_indexClasses.push_back(classesAndGroups[i]);
+
+		std::map<string, UGRegistryGroup> groups;
+		GetGroups(groups);
+		for(map<string, UGRegistryGroup>::iterator it = groups.begin(); it != groups.end(); ++it)
+			if(filter.group_selected(it->first))
+				m_groupPages[GetFilenameForGroup(it->first)] = it->first;
+
+		// the pages reference the assets by their content hash, they never change
+		CaptureSink capture;
+		{
+			ScopedOutputSink scope(capture);
+			WriteAssets("");
+		}
+		m_assets.swap(capture.files);
+	}
+
+	/// HTTP status of the page name, content is the page or an error message
+	int get(const string &name, string &content)
+	{
+		map<string, string>::iterator it = m_assets.find(name);
+		if(it != m_assets.end())
+		{
+			content = it->second;
+			return 200;
+		}
+		if(m_cache.get(name, content))
+			return 200;
+		if(m_missing.count(name))
+			return not_found(name, content);
+
+		try
+		{
+			if(render_page(name, content))
+				return 200;
+		}
+		catch(UGError &err)
+		{
+			stringstream ss;
+			for(size_t i=0; i<err.num_msg(); i++)
+				ss << err.get_file(i) << ":" << err.get_line(i) << " : " << err.get_msg(i) << "\n";
+			UG_ERR_LOG("UGError rendering '" << name << "':\n" << ss.str());
+			content = ss.str();
+			return 500;
+		}
+		// e.g. a misspelled index shard would render all indices on every request
+		if(m_missing.size() >= MAX_MISSING)
+			m_missing.clear();
+		m_missing.insert(name);
+		return not_found(name, content);
+	}
+
+private:
+	/// names remembered as missing, the registry doesn't change while serving
+	static const size_t MAX_MISSING = 4096;
+
+	int not_found(const string &name, string &content)
+	{
+		content = "'" + name + "' not found\n";
+		return 404;
+	}
+
+	/// renders the writer producing name, all files it writes are cached
+	bool render_page(const string &name, string &content)
+	{
+		DOCUGEN_LOG(LL_VERBOSE, "rendering '" << name << "'\n");
+		CaptureSink capture;
+		{
+			ScopedOutputSink scope(capture);
+			const IExportedClass *c = find_class(name);
+			map<string, string>::iterator group = m_groupPages.find(name);
+			if(c != NULL)
+				WriteClassHTML("", GetUGDocuClassDescription(m_classes, c), m_hierarchy);
+			else if(group != m_groupPages.end())
+				WriteRegistryGroupPage("", group->second);
+			else if(name == "groups_index.html")
+				WriteGroupsIndex("");
+			else if(name == "hierarchy.html")
+				WriteClassHierarchy("", m_hierarchy);
+			else if(StartsWith(name, "index") || StartsWith(name, "groupindex"))
+			{
+				WriteClassIndex("", m_indexClasses, false);
+				WriteClassIndex("", m_indexClasses, true);
+			}
+			else if(StartsWith(name, "functions") || StartsWith(name, "groupedfunctions"))
+				WriteGlobalFunctionIndices("");
+			else if(StartsWith(name, "search"))
+				WriteSearchIndex("");
+		}
+
+		map<string, string>::iterator it = capture.files.find(name);
+		if(it == capture.files.end()) return false;
+		content = it->second;
+		// the requested page is put last, so it is not evicted by its siblings
+		capture.files.erase(it);
+		for(it = capture.files.begin(); it != capture.files.end(); ++it)
+			m_cache.put(it->first, it->second);
+		m_cache.put(name, content);
+		return true;
+	}
+
+	/// the selected class with the page name, NULL if there is none
+	const IExportedClass *find_class(const string &name)
+	{
+		if(name.size() <= 5 || name.compare(name.size()-5, 5, ".html") != 0) return NULL;
+		string className = name.substr(0, name.size()-5);
+		Registry &reg = GetUGRegistry();
+		const DocuGenFilter &filter = GetDocuGenFilter();
+		for(size_t i=0; i<reg.num_classes(); i++)
+		{
+			const IExportedClass *c = &reg.get_class(i);
+			if(className == c->name() && filter.class_selected(c))
+				return c;
+		}
+		return NULL;
+	}
+
+	std::vector<UGDocuClassDescription> &m_classes;
+	std::vector<UGDocuClassDescription> m_indexClasses;
+	ClassHierarchy &m_hierarchy;
+	/// page filename -> registry group
+	std::map<string, string> m_groupPages;
+	std::map<string, string> m_assets;
+	PageCache m_cache;
+	std::set<string> m_missing;
+};
+
+
+#ifdef UG_DOCUGEN_SOCKETS
+
+/// listening socket, a unix socket file is removed again on destruction
+class ListeningSocket
+{
+public:
+	ListeningSocket(const string &address) : m_fd(-1)
+	{
+		if(StartsWith(address, "unix:"))
+			listen_unix(address.substr(5));
+		else
+			listen_loopback(address);
+		if(listen(m_fd, 16) != 0)
+			UG_THROW("could not listen on '" << address << "': " << strerror(errno));
+	}
+
+	~ListeningSocket()
+	{
+		if(m_fd >= 0) close(m_fd);
+		if(!m_unixPath.empty()) unlink(m_unixPath.c_str());
+	}
+
+	int fd() const { return m_fd; }
+
+private:
+	void listen_unix(const string &path)
+	{
+		sockaddr_un addr;
+		memset(&addr, 0, sizeof(addr));
+		addr.sun_family = AF_UNIX;
+		if(path.empty() || path.size() >= sizeof(addr.sun_path))
+			UG_THROW("invalid socket path '" << path << "'.");
+		strcpy(addr.sun_path, path.c_str());
+
+		m_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+		if(m_fd < 0)
+			UG_THROW("could not create a socket: " << strerror(errno));
+
+		// a socket left by an earlier server is removed, but only if nobody
+		// accepts connections on it any more. Other files are never removed.
+		struct stat st;
+		if(lstat(path.c_str(), &st) == 0 && S_ISSOCK(st.st_mode))
+		{
+			int probe = socket(AF_UNIX, SOCK_STREAM, 0);
+			if(probe < 0)
+				UG_THROW("could not create a socket: " << strerror(errno));
+			bool bInUse = connect(probe, (sockaddr*) &addr, sizeof(addr)) == 0;
+			int err = errno;
+			close(probe);
+			if(bInUse)
+				UG_THROW("'" << path << "' is in use by another server.");
+			if(err == ECONNREFUSED)
+				unlink(path.c_str());
+		}
+		if(bind(m_fd, (sockaddr*) &addr, sizeof(addr)) != 0)
+			UG_THROW("could not bind '" << path << "': " << strerror(errno));
+		m_unixPath = path;
+		UG_LOG("Serving the docu on the unix socket " << path << "\n");
+	}
+
+	void listen_loopback(const string &address)
+	{
+		string host = "127.0.0.1", port = address;
+		size_t colon = address.rfind(':');
+		if(colon != string::npos)
+		{
+			host = address.substr(0, colon);
+			port = address.substr(colon+1);
+		}
+		if(host != "127.0.0.1" && host != "localhost")
+			UG_THROW("the docu server only listens on the loopback interface, got host '" << host << "'.");
+		stringstream ss(port);
+		unsigned int portNumber;
+		if(!(ss >> portNumber) || !ss.eof() || portNumber > 65535)
+			UG_THROW("invalid port '" << port << "'.");
+
+		m_fd = socket(AF_INET, SOCK_STREAM, 0);
+		if(m_fd < 0)
+			UG_THROW("could not create a socket: " << strerror(errno));
+		int one = 1;
+		setsockopt(m_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+		sockaddr_in addr;
+		memset(&addr, 0, sizeof(addr));
+		addr.sin_family = AF_INET;
+		addr.sin_port = htons(portNumber);
+		addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		if(bind(m_fd, (sockaddr*) &addr, sizeof(addr)) != 0)
+			UG_THROW("could not bind 127.0.0.1:" << portNumber << ": " << strerror(errno));
+		// port 0 was replaced by a free port
+		socklen_t len = sizeof(addr);
+		getsockname(m_fd, (sockaddr*) &addr, &len);
+		UG_LOG("Serving the docu at http://127.0.0.1:" << ntohs(addr.sin_port) << "/\n");
+	}
+
+	int m_fd;
+	string m_unixPath;
+};
+
+/// method and path of the request line, false if the request is incomplete
+static bool ReadRequest(int fd, string &method, string &path)
+{
+	string request;
+	char buf[4096];
+	while(request.find("\r\n\r\n") == string::npos && request.find("\n\n") == string::npos
+			&& request.size() < 65536)
+	{
+		ssize_t n = recv(fd, buf, sizeof(buf), 0);
+		if(n <= 0) break;
+		request.append(buf, n);
+	}
+	stringstream ss(request.substr(0, request.find('\n')));
+	ss >> method >> path;
+	return !path.empty();
+}
+
+/// "/a%20b.html?x" -> "a b.html", "/" -> "index.html". All pages are in one
+/// directory, so false for names with '/'
+static bool PageName(const string &path, string &name)
+{
+	string p = path.substr(0, path.find_first_of("?#"));
+	if(p.empty() || p[0] != '/') return false;
+	name.clear();
+	for(size_t i=1; i<p.size(); i++)
+	{
+		if(p[i] == '%' && i+2 < p.size() && isxdigit((unsigned char) p[i+1]) && isxdigit((unsigned char) p[i+2]))
+		{
+			name += (char) strtol(p.substr(i+1, 2).c_str(), NULL, 16);
+			i += 2;
+		}
+		else
+			name += p[i];
+	}
+	if(name.empty()) name = "index.html";
+	return name.find('/') == string::npos && name.find('\0') == string::npos;
+}
+
+static const char *ContentType(const string &name)
+{
+	size_t dot = name.rfind('.');
+	string ext = dot == string::npos ? "" : name.substr(dot);
+	if(ext == ".html") return "text/html; charset=iso-8859-1";
+	if(ext == ".css") return "text/css";
+	if(ext == ".js") return "application/javascript";
+	if(ext == ".json") return "application/json";
+	return "text/plain";
+}
+
+static const char *StatusText(int status)
+{
+	switch(status)
+	{
+		case 200: return "OK";
+		case 400: return "Bad Request";
+		case 403: return "Forbidden";
+		case 404: return "Not Found";
+		case 405: return "Method Not Allowed";
+		default: return "Internal Server Error";
+	}
+}
+
+static void SendResponse(int fd, int status, const char *contentType, const string &content, bool bBody)
+{
+	stringstream ss;
+	ss << "HTTP/1.0 " << status << " " << StatusText(status) << "\r\n"
+		<< "Content-Type: " << contentType << "\r\n"
+		<< "Content-Length: " << content.size() << "\r\n"
+		<< "Connection: close\r\n\r\n";
+	if(bBody) ss << content;
+	string response = ss.str();
+
+	int flags = 0;
+#ifdef MSG_NOSIGNAL
+	// a closed connection must not end the server with SIGPIPE
+	flags = MSG_NOSIGNAL;
+#endif
+	for(size_t sent = 0; sent < response.size(); )
+	{
+		ssize_t n = send(fd, response.data() + sent, response.size() - sent, flags);
+		if(n <= 0) return;
+		sent += n;
+	}
+}
+
+/// random hex string of this run, /quit has to name it, so that other pages can't stop the server
+static string QuitToken()
+{
+	unsigned char bytes[16];
+	ifstream in("/dev/urandom", ios::binary);
+	if(!in.read((char*) bytes, sizeof(bytes)))
+		UG_THROW("could not read /dev/urandom for the quit token.");
+	stringstream ss;
+	ss << hex << setfill('0');
+	for(size_t i=0; i<sizeof(bytes); i++)
+		ss << setw(2) << (int) bytes[i];
+	return ss.str();
+}
+
+void ServeHTMLDocu(const std::string &address, std::vector<UGDocuClassDescription> &classes,
+		std::vector<UGDocuClassDescription> &classesAndGroups, ClassHierarchy &hierarchy,
+		size_t cacheSize)
+{
+	try{
+	DocuServer server(classes, classesAndGroups, hierarchy, cacheSize);
+	ListeningSocket socket(address);
+	string quitPath = "/quit?" + QuitToken();
+	UG_LOG("Stop the server with POST " << quitPath << "\n");
+
+	for(bool bQuit = false; !bQuit; )
+	{
+		int client = accept(socket.fd(), NULL, NULL);
+		if(client < 0)
+		{
+			if(errno == EINTR) continue;
+			UG_THROW("accept failed: " << strerror(errno));
+		}
+#ifdef SO_NOSIGPIPE
+		int one = 1;
+		setsockopt(client, SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof(one));
+#endif
+		// a client which sends or reads nothing must not block the server
+		timeval timeout;
+		timeout.tv_sec = 5;
+		timeout.tv_usec = 0;
+		setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+		setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+		string method, path, name, content;
+		int status;
+		if(!ReadRequest(client, method, path))
+		{
+			status = 400;
+			content = "bad request\n";
+		}
+		else if(path == "/quit" || StartsWith(path, "/quit?"))
+		{
+			if(method != "POST" || path != quitPath)
+			{
+				status = 403;
+				content = "stopping the server needs POST with the token in the log\n";
+			}
+			else
+			{
+				status = 200;
+				content = "docu server stopped\n";
+				bQuit = true;
+			}
+		}
+		else if(method != "GET" && method != "HEAD")
+		{
+			status = 405;
+			content = "only GET and HEAD are supported\n";
+		}
+		else if(!PageName(path, name))
+		{
+			status = 404;
+			content = "'" + path + "' not found\n";
+		}
+		else
+			status = server.get(name, content);
+		DOCUGEN_LOG(LL_TRACE, method << " " << path << " " << status << "\n");
+
+		SendResponse(client, status, status == 200 && !bQuit ? ContentType(name) : "text/plain",
+				content, method != "HEAD");
+		close(client);
+	}
+	UG_LOG("Docu server stopped.\n");
+	}UG_CATCH_THROW_FUNC();
+}
+
+#else
+
+void ServeHTMLDocu(const std::string &address, std::vector<UGDocuClassDescription> &classes,
+		std::vector<UGDocuClassDescription> &classesAndGroups, ClassHierarchy &hierarchy,
+		size_t cacheSize)
+{
+	UG_THROW("the docu server needs POSIX sockets, which are not available on this platform.");
+}
+
+#endif
+
+}	// namespace DocuGen
+}	// namespace ug
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2013-2016:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+
+#ifndef __UG__DOCU_SERVER_H__
+#define __UG__DOCU_SERVER_H__
+
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+#include "bridge/bridge.h"
+#include "ug_docu_class_description.h"
+
+namespace ug
+{
+namespace DocuGen
+{
+
+/// \addtogroup apps_ugdocu
+/// \{
+
+/**
+ * \brief Rendered pages of the docu server, the least recently used ones are evicted
+ */
+class PageCache
+{
+public:
+	PageCache(size_t capacity);
+
+	/// copies the page name into content and marks it as most recently used,
+	/// false if it is not cached
+	bool get(const std::string &name, std::string &content);
+	/// adds or replaces the page name, evicts the least recently used page if full
+	void put(const std::string &name, const std::string &content);
+
+	size_t size() const { return m_index.size(); }
+	size_t capacity() const { return m_capacity; }
+
+private:
+	typedef std::list<std::pair<std::string, std::string> > PageList;
+	/// most recently used first
+	PageList m_pages;
+	std::map<std::string, PageList::iterator> m_index;
+	size_t m_capacity;
+};
+
+/**
+ * \brief Serves the HTML docu over HTTP, rendering every page on its first request
+ * \details address is "port" or "host:port" with host localhost or 127.0.0.1
+ *   (port 0 picks a free port), or "unix:/path/to/socket". Only the loopback
+ *   interface is used, the docu is not meant to be published this way.
+ *
+ *   The class descriptions stay in memory. A requested page is rendered by the
+ *   same functions as WriteHTMLDocu, all files written by such a call (e.g. all
+ *   shards of an index) go into a PageCache of cacheSize pages. The CSS and
+ *   script assets are rendered once at startup and never evicted. Requests are
+ *   handled one after another, each with a send and receive
+ *   timeout of 5 s. "POST /quit?token" stops the server, the random token of
+ *   the run is logged at startup, so that no other page can stop it. Names
+ *   which aren't found are remembered, they are not rendered again.
+ */
+void ServeHTMLDocu(const std::string &address, std::vector<UGDocuClassDescription> &classes,
+		std::vector<UGDocuClassDescription> &classesAndGroups, bridge::ClassHierarchy &hierarchy,
+		size_t cacheSize);
+
+// end group apps_ugdocu
+/// \}
+
+}	// namespace DocuGen
+}	// namespace ug
+
+#endif /* __UG__DOCU_SERVER_H__ */
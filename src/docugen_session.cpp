@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2013-2016:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+
+#include "common/log.h"
+#include "common/error.h"
+#include "registry/class_helper.h"
+
+#include "ugdocu_misc.h"
+#include "output_file.h"
+#include "docugen_session.h"
+
+using namespace std;
+
+namespace ug
+{
+
+namespace DocuGen
+{
+
+using namespace bridge;
+
+DocuGenSession::DocuGenSession() :
+	  m_bValid( false )
+	, m_registryFingerprint( 0 )
+	, m_classGroupsFingerprint( 0 )
+{}
+
+void DocuGenSession::clear()
+{
+	classes.clear();
+	classesAndGroups.clear();
+	classesAndGroupsAndImplementations.clear();
+	m_usage.clear();
+	{
+		std::lock_guard<std::mutex> lock(m_fragmentMutex);
+		m_fragments.clear();
+	}
+	ForgetWrittenFiles();
+	m_bValid = false;
+}
+
+uint64_t DocuGenSession::registry_fingerprint() const
+{
+	Registry &reg = GetUGRegistry();
+	stringstream ss;
+	ss << reg.num_classes() << " " << reg.num_class_groups() << " " << reg.num_functions() << "\n";
+	for(size_t i=0; i<reg.num_classes(); i++)
+		ss << class_fingerprint(&reg.get_class(i)) << "\n";
+	for(size_t i=0; i<reg.num_class_groups(); i++)
+	{
+		const ClassGroupDesc *g = reg.get_class_group(i);
+		ss << g->name() << " " << g->num_classes() << " " << g->get_default_class() << "\n";
+	}
+	for(size_t i=0; i<reg.num_functions(); i++)
+		ss << reg.get_function_group(i).name() << " " << reg.get_function_group(i).num_overloads() << "\n";
+	return ContentHash(ss.str());
+}
+
+uint64_t DocuGenSession::class_groups_fingerprint() const
+{
+	stringstream ss;
+	for(size_t i=0; i<classes.size(); i++)
+	{
+		const UGDocuClassDescription &d = classes[i];
+		if(d.mp_class == NULL) continue;
+		ss << d.mp_class->name() << " " << (d.mp_group ? d.mp_group->name() : string()) << "\n";
+	}
+	return ContentHash(ss.str());
+}
+
+uint64_t DocuGenSession::class_fingerprint(const IExportedClass *c) const
+{
+	stringstream ss;
+	ss << c->name() << " " << c->num_constructors();
+	for(size_t i=0; i<c->num_methods(); i++)
+		ss << " " << c->get_method_group(i).num_overloads();
+	ss << " |";
+	for(size_t i=0; i<c->num_const_methods(); i++)
+		ss << " " << c->get_const_method_group(i).num_overloads();
+	return ContentHash(ss.str());
+}
+
+/// distinct classes used in par, as found by IsClassInParameters
+static void ClassesInParameters(const ParameterInfo &par, vector<string> &classNames)
+{
+	classNames.clear();
+	for(size_t i=0; i<(size_t)par.size(); i++)
+	{
+		if(par.class_name(i) == NULL) continue;
+		string name = par.class_name(i);
+		if(find(classNames.begin(), classNames.end(), name) == classNames.end()
+				&& IsClassInParameters(par, name.c_str()))
+			classNames.push_back(name);
+	}
+}
+
+void DocuGenSession::build_usage_index()
+{
+	Registry &reg = GetUGRegistry();
+	m_usage.clear();
+	vector<string> names;
+
+	for(size_t i=0; i<reg.num_functions(); i++)
+	{
+		const ExportedFunction &func = reg.get_function(i);
+		ClassesInParameters(func.params_in(), names);
+		for(size_t k=0; k<names.size(); k++)
+			m_usage[names[k]].functionsIn.push_back(&func);
+		ClassesInParameters(func.params_out(), names);
+		for(size_t k=0; k<names.size(); k++)
+			m_usage[names[k]].functionsOut.push_back(&func);
+	}
+
+	for(size_t i=0; i<reg.num_classes(); i++)
+	{
+		const IExportedClass &c = reg.get_class(i);
+		for(size_t j=0; j<c.num_methods(); j++)
+		{
+			const ExportedMethodGroup &grp = c.get_method_group(j);
+			for(size_t l=0; l<grp.num_overloads(); l++)
+			{
+				const ExportedMethod *method = grp.get_overload(l);
+				ClassesInParameters(method->params_in(), names);
+				for(size_t k=0; k<names.size(); k++)
+					m_usage[names[k]].methodsIn.push_back(make_pair(method, &c));
+				ClassesInParameters(method->params_out(), names);
+				for(size_t k=0; k<names.size(); k++)
+					m_usage[names[k]].methodsOut.push_back(make_pair(method, &c));
+			}
+		}
+		for(size_t j=0; j<c.num_const_methods(); j++)
+		{
+			const ExportedMethodGroup &grp = c.get_const_method_group(j);
+			for(size_t l=0; l<grp.num_overloads(); l++)
+			{
+				const ExportedMethod *method = grp.get_overload(l);
+				ClassesInParameters(method->params_in(), names);
+				for(size_t k=0; k<names.size(); k++)
+					m_usage[names[k]].bConstIn = true;
+				ClassesInParameters(method->params_out(), names);
+				for(size_t k=0; k<names.size(); k++)
+					m_usage[names[k]].bConstOut = true;
+			}
+		}
+	}
+}
+
+bool DocuGenSession::update()
+{
+	try{
+	uint64_t fingerprint = registry_fingerprint();
+	if(m_bValid && fingerprint == m_registryFingerprint)
+		return false;
+
+	classes.clear();
+	classesAndGroups.clear();
+	classesAndGroupsAndImplementations.clear();
+	GetGroups(classes, classesAndGroups, classesAndGroupsAndImplementations);
+	build_usage_index();
+
+	// keep the fragments of unchanged classes. The fragments also name the
+	// class groups of other classes (e.g. parameter types), so all of them
+	// are dropped if any class moved to another group.
+	uint64_t classGroupsFingerprint = class_groups_fingerprint();
+	{
+		std::lock_guard<std::mutex> lock(m_fragmentMutex);
+		if(classGroupsFingerprint != m_classGroupsFingerprint)
+			m_fragments.clear();
+		map<FragmentKey, Fragment>::iterator it = m_fragments.begin();
+		while(it != m_fragments.end())
+		{
+			if(it->second.fingerprint != class_fingerprint(it->first.first) + ContentHash(GetClassGroup(it->first.first->name())))
+				m_fragments.erase(it++);
+			else
+				++it;
+		}
+	}
+
+	m_registryFingerprint = fingerprint;
+	m_classGroupsFingerprint = classGroupsFingerprint;
+	m_bValid = true;
+	return true;
+	}UG_CATCH_THROW_FUNC();
+	return false;
+}
+
+const ClassUsage *DocuGenSession::class_usage(const string &className) const
+{
+	map<string, ClassUsage>::const_iterator it = m_usage.find(className);
+	return it == m_usage.end() ? NULL : &it->second;
+}
+
+bool DocuGenSession::get_fragment(const IExportedClass *c, bool bInherited, string &html)
+{
+	std::lock_guard<std::mutex> lock(m_fragmentMutex);
+	map<FragmentKey, Fragment>::iterator it = m_fragments.find(make_pair(c, bInherited));
+	if(it == m_fragments.end()) return false;
+	html = it->second.html;
+	return true;
+}
+
+void DocuGenSession::set_fragment(const IExportedClass *c, bool bInherited, const string &html)
+{
+	// the class group name is part of the headings
+	uint64_t fingerprint = class_fingerprint(c) + ContentHash(GetClassGroup(c->name()));
+	std::lock_guard<std::mutex> lock(m_fragmentMutex);
+	Fragment &fragment = m_fragments[make_pair(c, bInherited)];
+	fragment.fingerprint = fingerprint;
+	fragment.html = html;
+}
+
+DocuGenSession &GetDocuGenSession()
+{
+	static DocuGenSession session;
+	return session;
+}
+
+}	// namespace DocuGen
+}	// namespace ug
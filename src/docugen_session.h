@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2013-2016:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __UG__DOCUGEN_SESSION_H__
+#define __UG__DOCUGEN_SESSION_H__
+
+#include <stdint.h>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "bridge/bridge.h"
+#include "ug_docu_class_description.h"
+
+namespace ug
+{
+namespace DocuGen
+{
+
+/// \addtogroup apps_ugdocu
+/// \{
+
+/// functions and methods having a class as parameter, in registry order (see WriteClassUsageExact)
+class ClassUsage
+{
+public:
+	ClassUsage() : bConstIn(false), bConstOut(false) {}
+
+	std::vector<const bridge::ExportedFunction*> functionsIn, functionsOut;
+	std::vector<std::pair<const bridge::ExportedMethod*, const bridge::IExportedClass*> > methodsIn, methodsOut;
+	/// whether a const method uses the class (only opens the usage section)
+	bool bConstIn, bConstOut;
+};
+
+/**
+ * \brief State of the docu generation kept between calls in one ugshell session
+ * \details Holds the class descriptions, an index of class usage in
+ *   parameters and rendered member function fragments of the class pages.
+ *   update() compares a fingerprint of the registry and only rebuilds if
+ *   classes, methods or functions were added (e.g. by loading a plugin).
+ *   Fragments of classes whose methods and class group didn't change are
+ *   reused, as long as no class changed its class group.
+ */
+class DocuGenSession
+{
+public:
+	DocuGenSession();
+
+	/// brings everything up to date with the registry, returns false if nothing changed
+	bool update();
+	/// forgets everything, also which files were written
+	void clear();
+
+	std::vector<UGDocuClassDescription> classes;
+	std::vector<UGDocuClassDescription> classesAndGroups;
+	std::vector<UGDocuClassDescription> classesAndGroupsAndImplementations;
+
+	/// NULL if the class is not used in any parameter
+	const ClassUsage *class_usage(const std::string &className) const;
+
+	/// \{
+	/// rendered output of PrintClassFunctionsHMTL, may be called from any thread
+	bool get_fragment(const bridge::IExportedClass *c, bool bInherited, std::string &html);
+	void set_fragment(const bridge::IExportedClass *c, bool bInherited, const std::string &html);
+	/// \}
+
+private:
+	void build_usage_index();
+	uint64_t registry_fingerprint() const;
+	uint64_t class_fingerprint(const bridge::IExportedClass *c) const;
+	/// hash of the class group of every class
+	uint64_t class_groups_fingerprint() const;
+
+	class Fragment
+	{
+	public:
+		uint64_t fingerprint;
+		std::string html;
+	};
+	typedef std::pair<const bridge::IExportedClass*, bool> FragmentKey;
+
+	bool m_bValid;
+	uint64_t m_registryFingerprint;
+	uint64_t m_classGroupsFingerprint;
+	std::map<std::string, ClassUsage> m_usage;
+	std::map<FragmentKey, Fragment> m_fragments;
+	std::mutex m_fragmentMutex;
+};
+
+/// the session of this process
+DocuGenSession &GetDocuGenSession();
+
+// end group apps_ugdocu
+/// \}
+
+}	// namespace DocuGen
+}	// namespace ug
+
+#endif /* __UG__DOCUGEN_SESSION_H__ */
@@ -30,7 +30,13 @@
  * GNU Lesser General Public License for more details.
  */
 
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <iostream>
+#include <map>
+#include <set>
 #include <sstream>
 
 #include <string>
@@ -42,6 +48,7 @@
 #include "registry/class_helper.h"
 #include "bridge/bridge.h"
 #include "common/util/parameter_parsing.h"
+#include "common/util/file_util.h"
 #include "compile_info/compile_info.h"
 
 #ifdef UG_PLUGINS
@@ -52,11 +59,20 @@
 #endif
 
 #include "html_generation.h"
+#include "output_file.h"
+#include "ugdocu_profiling.h"
+#include "ugdocu_parallel.h"
+#include "ugdocu_log.h"
+#include "ugdocu_options.h"
+#include "docugen_session.h"
+#include "ugdocu_filter.h"
+#include "search_index.h"
+#include "single_page.h"
 
 // to refresh this file, use xxd -i ugdocu.css > ugdocu.css.h
 #include "ugdocu.css.h"
-// to refresh this file, use xxd -i clickEventHandler.txt > clickEventHandler.txt.h
-#include "clickEventHandler.txt.h"
+// to refresh this file, use xxd -i clickEventHandler.js > clickEventHandler.js.h
+#include "clickEventHandler.js.h"
 
 
 using namespace std;
@@ -68,40 +84,55 @@ namespace ug
 namespace DocuGen
 {
 
-string GetClassGroup(string classname);
-template<typename T>
-void remove_doubles(vector<T> &v)
+string AssetFilename(const string &name, const unsigned char *data, size_t len)
 {
-	std::vector<T> v2;
-	for(size_t i=0; i<v.size(); i++)
-	{
-		size_t j;
-		for(j=i+1; j<v.size(); j++)
-		{
-			if(j == i) continue;
-			if(v[i] == v[j]) break;
-		}
-		if(j == v.size())
-			v2.push_back(v[i]);
-	}
-	swap(v, v2);
+	size_t dot = name.rfind('.');
+	string hash = ContentHashToString(ContentHash(string((const char *) data, len))).substr(0, 8);
+	return name.substr(0, dot) + "." + hash + name.substr(dot);
+}
+
+void WriteAsset(const char *dir, const string &name, const unsigned char *data, size_t len)
+{
+	string filename = string(dir) + AssetFilename(name, data, len);
+	// the name changes with the content, so an existing file is up to date
+	if(OutputFileExists(filename))
+		return;
+	OutputFile f(filename);
+	f.write((const char *) data, len);
+}
+
+const string &UGDocuCSSFilename()
+{
+	static const string filename = AssetFilename("ugdocu.css", ugdocu_css, ugdocu_css_len);
+	return filename;
+}
+
+static const string &ClickEventHandlerFilename()
+{
+	static const string filename = AssetFilename("clickEventHandler.js", clickEventHandler_js, clickEventHandler_js_len);
+	return filename;
 }
 
-void WriteHeader(fstream &file, const string &title)
+void WriteHeader(ostream &file, const string &title, bool bTreeScript)
 {
 	file << "<address style=\"align: right;\"><small>";
 
+	// pages are written in parallel, so no localtime/asctime with their static buffers
 	time_t now = time(0);
-	tm *local = localtime(&now);
-	file << "ug4 bridge docu. SVN Revision " << UGSvnRevision() << ". Generated on " << asctime(local);
+	tm local;
+	localtime_r(&now, &local);
+	char date[32];
+	strftime(date, sizeof(date), "%a %b %e %H:%M:%S %Y\n", &local);
+	file << "ug4 bridge docu. SVN Revision " << UGSvnRevision() << ". Generated on " << date;
 	file << "</small></address>" << endl;
 
 	file << "<hr size=\"1\">";
 	file << "<!DOCTYPE HTML PUBLIC \"-//W3C//DTD HTML 4.01 Transitional//EN\">" << endl;
 	file << "<html><head><meta http-equiv=\"Content-Type\" content=\"text/html;charset=iso-8859-1\">";
 	file << "<title>" << tohtmlstring(title) << "</title>" << endl;
-	file << "<link href=\"ugdocu.css\" rel=\"stylesheet\" type=\"text/css\">" << endl;
-	file << clickEventHandler_txt << endl;
+	file << "<link href=\"" << UGDocuCSSFilename() << "\" rel=\"stylesheet\" type=\"text/css\">" << endl;
+	if(bTreeScript)
+		file << "<script type=\"text/javascript\" src=\"" << ClickEventHandlerFilename() << "\"></script>" << endl;
 	file << "</head><body>" << endl;
 
 	//file << "<div class=\"qindex\"><a class=\"qindex\" href=\"hierarchy.html\">Class Hierarchy</a>";
@@ -109,17 +140,64 @@ void WriteHeader(fstream &file, const string &title)
 	file << " | <a class=\"qindex\" href=\"groupindex.html\">Class Index by Group</a>";
 	file << " | <a class=\"qindex\" href=\"functions.html\">Global Functions</a>";
 	file << " | <a class=\"qindex\" href=\"groupedfunctions.html\">Global Functions by Group</a>";
-	file << " | <a class=\"qindex\" href=\"groups_index.html\">Registry Groups and Plugins</a> |";
+	file << " | <a class=\"qindex\" href=\"groups_index.html\">Registry Groups and Plugins</a>";
+	file << " | <a class=\"qindex\" href=\"search.html\">Search</a> |";
 	file << "</div>" << endl;
 }
 
-void WriteFooter(fstream &file)
+void WriteFooter(ostream &file)
 {
 
 	file << "</body>" << endl << "</html>" << endl;
 }
 
 
+/// table row markup of FunctionInfoHTML, ConstructorInfoHTML and the indices
+enum RowFragment
+{
+	RF_ITEM_LEFT,		///< opens a row and its left (return value) cell
+	RF_ITEM_RIGHT,		///< closes the left cell and opens the right (name) cell
+	RF_ITEM_END,		///< closes a row
+	RF_DESC,			///< opens a row of a tooltip, help or return value name
+	RF_DESC3,			///< same in the three-column tables of global functions
+	RF_DESC_END,		///< closes a description row
+	RF_GROUP_LEFT,		///< opens a row of the global functions with the group cell
+	RF_GROUP_ITEM,		///< closes the group cell and opens the left cell
+	NUM_ROW_FRAGMENTS
+};
+
+/// verbose and compact (see DocuGenOptions::compactMarkup) markup,
+/// the short classes l, r, g and m are defined in ugdocu.css
+static const char * const rowFragments[2][NUM_ROW_FRAGMENTS] =
+{
+	{
+		"<tr><td class=\"memItemLeft\" nowrap align=right valign=top>",
+		"</td><td class=\"memItemRight\" valign=bottom>",
+		"</td></tr>",
+		"<tr><td class=\"mdescLeft\">&#160;</td><td class=\"mdescRight\">",
+		"<tr><td class=\"mdescLeft\">&#160;</td><td class=\"mdescLeft\">&#160;</td><td class=\"mdescRight\">",
+		"<br/></td></tr>",
+		"<tr><td class=\"mdescLeft\">",
+		"</td><td class=\"memItemLeft\" nowrap align=right valign=top>"
+	},
+	{
+		// end tags of cells and rows are optional in HTML
+		"<tr><td class=l>",
+		"<td class=r>",
+		"",
+		"<tr class=m><td><td>",
+		"<tr class=m><td><td><td>",
+		"",
+		"<tr><td class=g>",
+		"<td class=l>"
+	}
+};
+
+static const char *Row(RowFragment f)
+{
+	return rowFragments[GetDocuGenOptions().compactMarkup ? 1 : 0][f];
+}
+
 string ConstructorInfoHTML(string classname, const bridge::ExportedConstructor &thefunc,
 		string group)
 {
@@ -127,22 +205,22 @@ string ConstructorInfoHTML(string classname, const bridge::ExportedConstructor &
 	stringstream file;
 
 	// function name
-	file << "<tr><td class=\"memItemLeft\" nowrap align=right valign=top>";
-	file << "</td><td class=\"memItemRight\" valign=bottom>";
+	file << Row(RF_ITEM_LEFT);
+	file << Row(RF_ITEM_RIGHT);
 	file << classname << " ";
 	WriteParametersIn(file, thefunc);
-	file << "</td></tr>";
+	file << Row(RF_ITEM_END);
 
 	if(thefunc.tooltip().size() > 0)
 	{
-		file << "<tr><td class=\"mdescLeft\">&#160;</td><td class=\"mdescRight\">";
-		file << "tooltip: " << XMLStringEscape(thefunc.tooltip()) << "<br/></td></tr>";
+		file << Row(RF_DESC);
+		file << "tooltip: " << XMLStringEscape(thefunc.tooltip()) << Row(RF_DESC_END);
 	}
 
 	if(thefunc.help().size() > 0 && thefunc.help().compare("No help") != 0)
 	{
-		file << "<tr><td class=\"mdescLeft\">&#160;</td><td class=\"mdescRight\">";
-		file << "help: " << XMLStringEscape(thefunc.help()) << "<br/></td></tr>";
+		file << Row(RF_DESC);
+		file << "help: " << XMLStringEscape(thefunc.help()) << Row(RF_DESC_END);
 	}
 	return file.str();
 	}UG_CATCH_THROW_FUNC();	return "";
@@ -155,10 +233,10 @@ string FunctionInfoHTML(const bridge::ExportedFunctionBase &thefunc,
 {
 	try{
 	stringstream file;
-	file << "<tr><td class=\"memItemLeft\" nowrap align=right valign=top>";
+	file << Row(RF_ITEM_LEFT);
 	WriteParametersOut(file, thefunc);
 
-	file << "</td><td class=\"memItemRight\" valign=bottom>";
+	file << Row(RF_ITEM_RIGHT);
 	if(bConst)
 		file << " const ";
 	if(c)
@@ -167,24 +245,24 @@ string FunctionInfoHTML(const bridge::ExportedFunctionBase &thefunc,
 	file << thefunc.name() << " ";
 
 	WriteParametersIn(file, thefunc);
-	file << "</td></tr>";
+	file << Row(RF_ITEM_END);
 
 	if(thefunc.return_name().size() > 0)
 	{
-		file << "<tr><td class=\"mdescLeft\">&#160;</td><td class=\"mdescRight\">";
-				file << "returns " << thefunc.return_name() << "<br/></td></tr>";
+		file << Row(RF_DESC);
+		file << "returns " << thefunc.return_name() << Row(RF_DESC_END);
 	}
 
 	if(thefunc.tooltip().size() > 0)
 	{
-		file << "<tr><td class=\"mdescLeft\">&#160;</td><td class=\"mdescRight\">";
-		file << "tooltip: " << XMLStringEscape(thefunc.tooltip()) << "<br/></td></tr>";
+		file << Row(RF_DESC);
+		file << "tooltip: " << XMLStringEscape(thefunc.tooltip()) << Row(RF_DESC_END);
 	}
 
 	if(thefunc.help().size() > 0 && thefunc.help().compare("No help") != 0)
 	{
-		file << "<tr><td class=\"mdescLeft\">&#160;</td><td class=\"mdescRight\">";
-		file << "help: " << XMLStringEscape(thefunc.help()) << "<br/></td></tr>";
+		file << Row(RF_DESC);
+		file << "help: " << XMLStringEscape(thefunc.help()) << Row(RF_DESC_END);
 	}
 	return file.str();
 
@@ -198,33 +276,32 @@ string FunctionInfoHTML(const bridge::ExportedFunctionBase &thefunc,
 {
 	try{
 	stringstream file;
-	file << "<tr>";
-	file << "<td class=\"mdescLeft\">" << group << "</td>";
-	file << "<td class=\"memItemLeft\" nowrap align=right valign=top>";
+	file << Row(RF_GROUP_LEFT) << group;
+	file << Row(RF_GROUP_ITEM);
 	WriteParametersOut(file, thefunc);
 
-	file << "</td><td class=\"memItemRight\" valign=bottom>";
+	file << Row(RF_ITEM_RIGHT);
 	file << thefunc.name() << " ";
 
 	WriteParametersIn(file, thefunc);
-	file << "</td></tr>";
+	file << Row(RF_ITEM_END);
 
 	if(thefunc.return_name().size() > 0)
 	{
-		file << "<tr><td class=\"mdescLeft\">&#160;</td><td class=\"mdescLeft\">&#160;</td><td class=\"mdescRight\">";
-				file << "returns " << thefunc.return_name() << "<br/></td></tr>";
+		file << Row(RF_DESC3);
+		file << "returns " << thefunc.return_name() << Row(RF_DESC_END);
 	}
 
 	if(thefunc.tooltip().size() > 0)
 	{
-		file << "<tr><td class=\"mdescLeft\">&#160;</td><td class=\"mdescLeft\">&#160;</td><td class=\"mdescRight\">";
-		file << "tooltip: " << XMLStringEscape(thefunc.tooltip()) << "<br/></td></tr>";
+		file << Row(RF_DESC3);
+		file << "tooltip: " << XMLStringEscape(thefunc.tooltip()) << Row(RF_DESC_END);
 	}
 
 	if(thefunc.help().size() > 0 && thefunc.help().compare("No help") != 0)
 	{
-		file << "<tr><<td class=\"mdescLeft\">&#160;</td><td class=\"mdescLeft\">&#160;</td><td class=\"mdescRight\">";
-		file << "help: " << XMLStringEscape(thefunc.help()) << "<br/></td></tr>";
+		file << Row(RF_DESC3);
+		file << "help: " << XMLStringEscape(thefunc.help()) << Row(RF_DESC_END);
 	}
 	return file.str();
 
@@ -241,68 +318,58 @@ string FunctionInfoHTML(const bridge::ExportedFunctionBase &thefunc,
 bool WriteClassUsageExact(const string &preamble, ostream &file, const char *classname, bool OutParameters)
 {
 	try{
-	Registry &reg = GetUGRegistry();
-	bool bPreambleWritten = false;
-	// check functions
-	for(size_t i=0; i<reg.num_functions(); i++)
-	{
-		vector<string> vstr;
-		const bridge::ExportedFunctionBase &thefunc = reg.get_function(i);
-		if((!OutParameters && IsClassInParameters(thefunc.params_in(), classname)) ||
-				(OutParameters && IsClassInParameters(thefunc.params_out(), classname)))
-		{
-			if(bPreambleWritten==false) { file << preamble; bPreambleWritten=true; }
-			vstr.push_back(FunctionInfoHTML(thefunc));
-		}
-		remove_doubles(vstr);
-		for(vector<string>::iterator it = vstr.begin(); it != vstr.end(); ++it)
-			file << *it;
+	// functions and methods using the class are indexed once per registry
+	// state instead of scanning the whole registry for every class page
+	const ClassUsage *usage = GetDocuGenSession().class_usage(classname);
+	if(usage == NULL) return true;
 
-	}
+	const vector<const ExportedFunction*> &functions = OutParameters ? usage->functionsOut : usage->functionsIn;
+	const vector<pair<const ExportedMethod*, const IExportedClass*> > &methods = OutParameters ? usage->methodsOut : usage->methodsIn;
+	bool bConst = OutParameters ? usage->bConstOut : usage->bConstIn;
 
-	// check classes
-	for(size_t i=0; i<reg.num_classes(); i++)
-	{
-		const IExportedClass &c = reg.get_class(i);
-		for(size_t i=0; i<c.num_methods(); i++)
-		{
-			const ExportedMethodGroup &grp = c.get_method_group(i);
-			for(size_t j=0; j< grp.num_overloads(); j++)
-			{
-				const bridge::ExportedMethod *thefunc = grp.get_overload(j);
-				if((!OutParameters && IsClassInParameters(thefunc->params_in(), classname)) ||
-						(OutParameters && IsClassInParameters(thefunc->params_out(), classname)))
-				{
-					if(bPreambleWritten==false) { file << preamble; bPreambleWritten=true; }
-					file << FunctionInfoHTML(*thefunc, &c, false);
-				}
-			}
+	if(functions.empty() && methods.empty() && !bConst) return true;
+	file << preamble;
 
-		}
+	for(size_t i=0; i<functions.size(); i++)
+		file << FunctionInfoHTML(*functions[i]);
+
+	for(size_t i=0; i<methods.size(); i++)
+		file << FunctionInfoHTML(*methods[i].first, methods[i].second, false);
 
-		for(size_t i=0; i<c.num_const_methods(); i++)
-		{
-			const ExportedMethodGroup &grp = c.get_const_method_group(i);
-			for(size_t j=0; j< grp.num_overloads(); j++)
-			{
-				const bridge::ExportedMethod *thefunc = grp.get_overload(j);
-				if((!OutParameters && IsClassInParameters(thefunc->params_in(), classname)) ||
-						(OutParameters && IsClassInParameters(thefunc->params_out(), classname)))
-				{
-					if(bPreambleWritten==false) { file << preamble; bPreambleWritten=true; }
-					FunctionInfoHTML(*thefunc, &c, true);
-				}
-			}
-		}
-	}
 	return true;
 	}UG_CATCH_THROW_FUNC();	return false;
 }
 
-void PrintClassFunctionsHMTL(ostream &file, const IExportedClass *c, bool bInherited)
+/**
+ * gives the first row of a FunctionInfoHTML the id the search links to:
+ * ClassName.name for member functions, name for global functions. Only the
+ * first overload on a page is anchored, ids have to be unique.
+ */
+static string AnchoredFunctionInfoHTML(const string &id, const string &html)
+{
+	if(html.compare(0, 4, "<tr>") != 0) return html;
+	return string("<tr id=\"") + id + "\">" + html.substr(4);
+}
+
+/// rows of the member functions of c, the first overload of each name is anchored
+static void WriteMemberFunctionRows(ostream &file, const IExportedClass *c,
+		const std::vector<const bridge::ExportedFunctionBase *> &sortedFunctions, set<string> &anchored)
+{
+	for(size_t i=0; i < sortedFunctions.size(); ++i)
+	{
+		const bridge::ExportedFunctionBase &f = *sortedFunctions[i];
+		if(anchored.insert(f.name()).second)
+			file << AnchoredFunctionInfoHTML(c->name() + "." + f.name(), FunctionInfoHTML(f));
+		else
+			file << FunctionInfoHTML(f);
+	}
+}
+
+static void RenderClassFunctionsHTML(ostream &file, const IExportedClass *c, bool bInherited)
 {
 	try{
-	if(c == NULL) return;
+	// const and non-const methods may share a name
+	set<string> anchored;
 
 	if(c->num_constructors())
 	{
@@ -326,8 +393,7 @@ void PrintClassFunctionsHMTL(ostream &file, const IExportedClass *c, bool bInher
 		file << "<tr><td colspan=2><h3>";
 		if(bInherited) file << "Inherited ";
 		file << GetClassGroup(c->name()) << " Member Functions</h3></td></tr>";
-		for(size_t i=0; i < sortedFunctions.size(); ++i)
-			file << FunctionInfoHTML(*sortedFunctions[i]);
+		WriteMemberFunctionRows(file, c, sortedFunctions, anchored);
 		file << "<tr><td><br></td></tr>";
 	}
 
@@ -346,22 +412,41 @@ void PrintClassFunctionsHMTL(ostream &file, const IExportedClass *c, bool bInher
 		if(bInherited) file << " Inherited ";
 		file << GetClassGroup(c->name()) << " Const Member Functions</h3></td></tr>";
 
-		for(size_t i=0; i < sortedFunctions.size(); ++i)
-			file << FunctionInfoHTML(*sortedFunctions[i]);
+		WriteMemberFunctionRows(file, c, sortedFunctions, anchored);
 		file << "<tr><td><br></td></tr>";
 	}
 	}UG_CATCH_THROW_FUNC();
 }
 
-// write the ugdocu.css
+void PrintClassFunctionsHMTL(ostream &file, const IExportedClass *c, bool bInherited)
+{
+	try{
+	if(c == NULL) return;
+
+	// base classes are printed on the pages of all their subclasses, and
+	// unchanged classes are reused by later calls in the same session
+	DocuGenSession &session = GetDocuGenSession();
+	string html;
+	if(!session.get_fragment(c, bInherited, html))
+	{
+		stringstream ss;
+		RenderClassFunctionsHTML(ss, c, bInherited);
+		html = ss.str();
+		session.set_fragment(c, bInherited, html);
+	}
+	file << html;
+	}UG_CATCH_THROW_FUNC();
+}
+
+// write ugdocu.css and the scripts shared by the pages
 //TODO: make sure dir exists and is writeable!
-void WriteUGDocuCSS(const char *dir)
+void WriteAssets(const char *dir)
 {
 	try{
-	UG_LOG("WriteUGDocuCSS... ");
-	fstream ugdocucss((string(dir).append("ugdocu.css")).c_str(), ios::out);
-	ugdocucss.write((char *)ugdocu_css, ugdocu_css_len);
-	UG_LOG(ugdocu_css_len << " characters." << endl);
+	UG_LOG("WriteAssets... ");
+	WriteAsset(dir, "ugdocu.css", ugdocu_css, ugdocu_css_len);
+	WriteAsset(dir, "clickEventHandler.js", clickEventHandler_js, clickEventHandler_js_len);
+	UG_LOG(UGDocuCSSFilename() << ", " << ClickEventHandlerFilename() << endl);
 
 	}UG_CATCH_THROW_FUNC();
 }
@@ -371,7 +456,7 @@ void WriteUGDocuCSS(const char *dir)
 void WriteClassHierarchy(const char *dir, ClassHierarchy &hierarchy)
 {
 	try{
-	fstream hierarchyhtml((string(dir).append("hierarchy.html")).c_str(), ios::out);
+	OutputFile hierarchyhtml(string(dir).append("hierarchy.html"));
 	WriteHeader(hierarchyhtml, "Class Hierarchy");
 	hierarchyhtml << "<h1>ugbridge Class Hierarchy (ug4)</h1>This inheritance list sorted hierarchically:<ul>";
 	for(size_t i=0; i<hierarchy.subclasses.size(); i++)
@@ -392,8 +477,9 @@ void WriteClassHTML(const char *dir, UGDocuClassDescription *d, ClassHierarchy &
 
 	const IExportedClass &c = *d->mp_class;
 	string name = c.name();
+	TraceSpan span("WriteClassHTML", name);
 
-	fstream classhtml((string(dir) + name + ".html").c_str(), ios::out);
+	OutputFile classhtml(string(dir) + name + ".html");
 	WriteHeader(classhtml, name);
 
 	if(d->mp_group == NULL)
@@ -402,7 +488,13 @@ void WriteClassHTML(const char *dir, UGDocuClassDescription *d, ClassHierarchy &
 	{
 		classhtml << "<h1>" << d->mp_group->name() << " Class Reference</h1>";
 		classhtml << name << "<br>" << d->tag << "<br>";
-		if(d->mp_group->get_default_class() == d->mp_class)
+		if(HasMultipleConfigurations())
+		{
+			string configs = GetDefaultConfigurations(d->mp_class);
+			if(!configs.empty())
+				classhtml << "(default implementation of classgroup " << d->mp_group->name() << " for " << configs << ")<br>";
+		}
+		else if(d->mp_group->get_default_class() == d->mp_class)
 			classhtml << "(default implementation of classgroup " << d->mp_group->name() << ")<br>";
 	}
 
@@ -505,7 +597,13 @@ void WriteClassHTML(const char *dir, UGDocuClassDescription *d, ClassHierarchy &
 		for(size_t j=0; j<d->mp_group->num_classes(); j++)
 		{
 			classhtml << "<li>" << "<a class=\"el\" href=\"" << d->mp_group->get_class(j)->name() << ".html\">" << d->mp_group->get_class(j)->name() << "</a> (" << GetBeautifiedTag(d->mp_group->get_class_tag(j)) << ")";
-			if(d->mp_group->get_default_class() == d->mp_group->get_class(j))
+			if(HasMultipleConfigurations())
+			{
+				string configs = GetDefaultConfigurations(d->mp_group->get_class(j));
+				if(!configs.empty())
+					classhtml << " (default for " << configs << ")";
+			}
+			else if(d->mp_group->get_default_class() == d->mp_group->get_class(j))
 				classhtml << " (default)";
 			classhtml << "\n";
 		}
@@ -521,6 +619,192 @@ void WriteClassHTML(const char *dir, UGDocuClassDescription *d, ClassHierarchy &
 	}UG_CATCH_THROW_FUNC();
 }
 
+/// one page of a sharded index, items are indices into the sorted entries
+class IndexShard
+{
+public:
+	string key;
+	string filename;
+	vector<size_t> items;
+};
+
+/// first letter of name in upper case, "other" for everything else
+static string LetterShardKey(const string &name)
+{
+	if(!name.empty() && isalpha((unsigned char) name[0]))
+		return string(1, (char) toupper((unsigned char) name[0]));
+	return "other";
+}
+
+/**
+ * e.g. index_A.html, characters other than letters, digits, '.' and '-' are
+ * replaced by '_'. Then a short hash of the key is appended, so that e.g.
+ * "a/b" and "a_b" get different pages.
+ */
+static string IndexShardFilename(const string &base, const string &key)
+{
+	string name = base + "_";
+	bool bReplaced = false;
+	for(size_t i=0; i<key.size(); i++)
+	{
+		unsigned char c = key[i];
+		bool bKept = isalnum(c) || c == '.' || c == '-';
+		name += bKept ? (char) c : '_';
+		bReplaced = bReplaced || !bKept;
+	}
+	if(bReplaced)
+		name += "_" + ContentHashToString(ContentHash(key)).substr(0, 8);
+	return name + ".html";
+}
+
+/// adds item to the shard of key, shards are kept in order of their first item
+static void AddToIndexShards(vector<IndexShard> &shards, map<string, size_t> &shardOfKey,
+		const string &base, const string &key, size_t item)
+{
+	map<string, size_t>::iterator it = shardOfKey.find(key);
+	if(it == shardOfKey.end())
+	{
+		it = shardOfKey.insert(make_pair(key, shards.size())).first;
+		shards.push_back(IndexShard());
+		shards.back().key = key;
+		string filename = IndexShardFilename(base, key);
+		// the hashes of two replaced keys may still collide
+		for(size_t i=0; i+1<shards.size(); i++)
+			if(shards[i].filename == filename)
+			{
+				stringstream ss;
+				ss << filename.substr(0, filename.size()-5) << "_" << shards.size() << ".html";
+				filename = ss.str();
+				break;
+			}
+		shards.back().filename = filename;
+	}
+	shards[it->second].items.push_back(item);
+}
+
+/// ParallelFor body writing the pages of a sharded index, TRowRenderer gives the table row of an item
+template<typename TRowRenderer>
+class IndexShardBody
+{
+public:
+	IndexShardBody(const string &dir, const string &title, const vector<IndexShard> &shards,
+			TRowRenderer &renderer, bool bRemoveDoubles)
+		: m_dir(dir), m_title(title), m_shards(shards), m_renderer(renderer), m_bRemoveDoubles(bRemoveDoubles) {}
+
+	void operator()(size_t i, size_t thread)
+	{
+		const IndexShard &shard = m_shards[i];
+		TraceSpan span("WriteIndexShard", shard.filename);
+		vector<string> rows;
+		for(size_t j=0; j<shard.items.size(); j++)
+			rows.push_back(m_renderer(shard.items[j]));
+		if(m_bRemoveDoubles)
+			remove_doubles(rows);
+
+		string title = m_title + ": " + shard.key;
+		OutputFile f(m_dir + shard.filename);
+		WriteHeader(f, title);
+		f << "<h1>" << XMLStringEscape(title) << "</h1>";
+		f << "<table border=0 cellpadding=0 cellspacing=0>"
+			<< "<tr><td></td></tr>";
+		for(size_t j=0; j<rows.size(); j++)
+			f << rows[j];
+		f << "</table>";
+		WriteFooter(f);
+	}
+
+private:
+	string m_dir;
+	string m_title;
+	const vector<IndexShard> &m_shards;
+	TRowRenderer &m_renderer;
+	bool m_bRemoveDoubles;
+};
+
+/**
+ * removes the shard pages linked from the old navigation page filename which
+ * are not among shards any more, e.g. of a registry group which disappeared
+ */
+static void RemoveStaleIndexShards(const string &dir, const string &filename, const vector<IndexShard> &shards)
+{
+	if(!OutputFileExists(dir + filename)) return;
+	ifstream in((dir + filename).c_str());
+	stringstream ss;
+	ss << in.rdbuf();
+	string nav = ss.str();
+
+	set<string> current;
+	for(size_t i=0; i<shards.size(); i++)
+		current.insert(shards[i].filename);
+	string prefix = filename.substr(0, filename.size()-5) + "_";
+	string href = "href=\"";
+	for(size_t pos = nav.find(href); pos != string::npos; pos = nav.find(href, pos))
+	{
+		pos += href.size();
+		size_t end = nav.find('"', pos);
+		if(end == string::npos) break;
+		string page = nav.substr(pos, end-pos);
+		if(page.compare(0, prefix.size(), prefix) != 0 || current.count(page)) continue;
+		string stale = dir + page;
+		remove(stale.c_str());
+		remove((stale + ".gz").c_str());
+	}
+}
+
+/// writes the shards in parallel and the navigation page filename linking to them
+template<typename TRowRenderer>
+static void WriteShardedIndex(const char *dir, const string &filename, const string &title,
+		const vector<IndexShard> &shards, TRowRenderer &renderer, bool bRemoveDoubles)
+{
+	{
+		IndexShardBody<TRowRenderer> body(dir, title, shards, renderer, bRemoveDoubles);
+		ParallelFor(shards.size(), body);
+	}
+	RemoveStaleIndexShards(dir, filename, shards);
+
+	OutputFile nav(string(dir) + filename);
+	WriteHeader(nav, title);
+	nav << "<h1>" << XMLStringEscape(title) << "</h1>\n<p>";
+	for(size_t i=0; i<shards.size(); i++)
+		nav << "<a class=\"qindex\" href=\"" << shards[i].filename << "\">" << XMLStringEscape(shards[i].key)
+			<< "</a>&nbsp;(" << shards[i].items.size() << ")\n" << (shards[i].key.size() > 1 ? "<br>" : "");
+	nav << "</p>";
+	WriteFooter(nav);
+}
+
+/// row of a class or class group in the class indices, "" if it has no page
+static string ClassIndexRowHTML(const UGDocuClassDescription &c)
+{
+	stringstream row;
+	row << Row(RF_ITEM_LEFT);
+	row << c.group_str();
+	row << " ";
+	row << Row(RF_ITEM_RIGHT);
+	if(c.mp_class == NULL) // group
+	{
+		if(c.mp_group == NULL) { UG_LOG("neighter group nor class???\n"); return ""; }
+		if(c.mp_group->get_default_class() == NULL) { UG_LOG("no default class\n"); return ""; }
+
+		row << "<a class=\"el\" href=\"" << c.mp_group->get_default_class()->name() << ".html\">" << c.mp_group->name() << "</a>\n";
+	}
+	else
+	{
+		row << "<a class=\"el\" href=\"" << c.name() << ".html\">" << c.name() << "</a>\n";
+	}
+	row << Row(RF_ITEM_END);
+	return row.str();
+}
+
+class ClassIndexRowRenderer
+{
+public:
+	ClassIndexRowRenderer(const vector<UGDocuClassDescription> &classes) : m_classes(classes) {}
+	string operator()(size_t i) { return ClassIndexRowHTML(m_classes[i]); }
+
+private:
+	const vector<UGDocuClassDescription> &m_classes;
+};
+
 // write alphabetical class index in index.html
 void WriteClassIndex(const char *dir, std::vector<UGDocuClassDescription> &classesAndGroups, bool bGroup)
 {
@@ -528,57 +812,47 @@ void WriteClassIndex(const char *dir, std::vector<UGDocuClassDescription> &class
 	UG_LOG("WriteClassIndex" << (bGroup?" by group " : "") << "... ");
 //	Registry &reg = GetUGRegistry();
 
-	fstream indexhtml((string(dir).append(bGroup ? "groupindex.html" : "index.html")).c_str(), ios::out);
+	if(bGroup)
+		sort(classesAndGroups.begin(), classesAndGroups.end(), GroupNameSortFunction);
+	else
+		sort(classesAndGroups.begin(), classesAndGroups.end(), NameSortFunction);
+
+	// one page per registry group or first letter
+	if(GetDocuGenOptions().indexShards)
+	{
+		vector<IndexShard> shards;
+		map<string, size_t> shardOfKey;
+		for(size_t i=0; i<classesAndGroups.size(); i++)
+		{
+			if(bGroup)
+				AddToIndexShards(shards, shardOfKey, "groupindex", classesAndGroups[i].group_str(), i);
+			else
+				AddToIndexShards(shards, shardOfKey, "index", LetterShardKey(classesAndGroups[i].name()), i);
+		}
+		ClassIndexRowRenderer renderer(classesAndGroups);
+		WriteShardedIndex(dir, bGroup ? "groupindex.html" : "index.html",
+				bGroup ? "ug4 Class Index by Group" : "ug4 Class Index", shards, renderer, false);
+		UG_LOG(classesAndGroups.size() << " class groups written to " << shards.size() << " pages. " << endl);
+		return;
+	}
+
+	OutputFile indexhtml(string(dir).append(bGroup ? "groupindex.html" : "index.html"));
 
 	if(bGroup)
 	{
 		WriteHeader(indexhtml, "Class Index by Group");
 		indexhtml << "<h1>ug4 Class Index by Group</h1>";
-		sort(classesAndGroups.begin(), classesAndGroups.end(), GroupNameSortFunction);
 	}
 	else
 	{
 		WriteHeader(indexhtml, "Class Index");
 		indexhtml << "<h1>ug4 Class Index</h1>";
-		sort(classesAndGroups.begin(), classesAndGroups.end(), NameSortFunction);
 	}
 
 	indexhtml 	<< "<table border=0 cellpadding=0 cellspacing=0>"
 					<< "<tr><td></td></tr>";
 	for(size_t i=0; i<classesAndGroups.size(); i++)
-	{
-		indexhtml << "<tr><td class=\"memItemLeft\" nowrap align=right valign=top>";
-
-		UGDocuClassDescription &c = classesAndGroups[i];
-		indexhtml << c.group_str();
-		indexhtml << " ";
-		indexhtml << "</td>";
-		indexhtml << "<td class=\"memItemRight\" valign=bottom>";
-		if(c.mp_class == NULL) // group
-		{
-			if(c.mp_group == NULL) { UG_LOG("neighter group nor class???\n"); continue; }
-			if(c.mp_group->get_default_class() == NULL) { UG_LOG("no default class\n"); continue; }
-
-			indexhtml << "<a class=\"el\" href=\"" << c.mp_group->get_default_class()->name() << ".html\">" << c.mp_group->name() << "</a>\n";
-			/*indexhtml << "<p> <font size=\"1\">\n";
-			indexhtml << "<ul>";
-			for(size_t j=0; j<c.group->num_classes(); j++)
-			{
-				indexhtml << "<li>" << "<a href=\"" << c.group->get_class(j)->name() << ".html\">" << c.group->get_class(j)->name() << "</a> (" << GetBeautifiedTag(c.group->get_class_tag(j)) << ")";
-				if(c.group->get_default_class() == c.group->get_class(j))
-					indexhtml << " (default)";
-				indexhtml << "\n";
-			}
-			indexhtml << "</ul>";
-			indexhtml << "</font></p>\n";*/
-		}
-		else
-		{
-			indexhtml << "<a class=\"el\" href=\"" << c.name() << ".html\">" << c.name() << "</a>\n";
-		}
-
-		indexhtml << "</td></tr>";
-	}
+		indexhtml << ClassIndexRowHTML(classesAndGroups[i]);
 
 	indexhtml 	<< "</table>";
 	WriteFooter(indexhtml);
@@ -589,167 +863,363 @@ void WriteClassIndex(const char *dir, std::vector<UGDocuClassDescription> &class
 
 void GetGroups(std::map<string, UGRegistryGroup> &g);
 
-// write alphabetical class index in index.html
-void WriteGroups(const char *dir, std::vector<UGDocuClassDescription> &classesAndGroups)
+/// writes the classes and functions tables of a group page
+static void WriteGroupHTML(ostream &out, const string &g, const UGRegistryGroup &group)
 {
-	try{
-	UG_LOG("WriteGroups...");
-//	Registry &reg = GetUGRegistry();
-
-	std::map<string, UGRegistryGroup> groups;
-	GetGroups(groups);
+	out << "\n";
+	out << "<h1>Group " << g << "</h1>\n";
 
-	std::map<string, string> groupsstring;
+	out << "<h2>Classes</h2>\n";
+	out << "<table border=0 cellpadding=0 cellspacing=0><tr><td></td></tr>";
 
-	for(map<string, UGRegistryGroup>::iterator it = groups.begin(); it != groups.end(); ++it)
+	for(size_t i=0; i< group.classesAndGroups.size(); i++)
 	{
-		string g = it->first;
-		UG_LOG("group '" << g << "'\n");
-		stringstream ss;
-		ss << "\n";
-		ss<< "<h1>Group " << g << "</h1>\n";
+		const UGDocuClassDescription &c = *group.classesAndGroups[i];
+		//if(strcmp(c.group_str().c_str(), g.c_str()) != 0) continue;
+		out << Row(RF_ITEM_LEFT);
 
-		ss << "<h2>Classes</h2>\n";
-		ss << "<table border=0 cellpadding=0 cellspacing=0><tr><td></td></tr>";
-
-		for(size_t i=0; i< it->second.classesAndGroups.size(); i++)
+		out << c.group_str();
+		out << " ";
+		out << Row(RF_ITEM_RIGHT);
+		if(c.mp_class == NULL) // group
 		{
-			UGDocuClassDescription &c = it->second.classesAndGroups[i];
-			//if(strcmp(c.group_str().c_str(), g.c_str()) != 0) continue;
-			ss << "<tr><td class=\"memItemLeft\" nowrap align=right valign=top>";
-
-			ss << c.group_str();
-			ss << " ";
-			ss << "</td>";
-			ss << "<td class=\"memItemRight\" valign=bottom>";
-			if(c.mp_class == NULL) // group
-			{
-				if(c.mp_group == NULL) { UG_LOG("neighter group nor class???\n"); }
-				else if(c.mp_group->get_default_class() == NULL) { UG_LOG("no default class\n");  }
-				else ss << "<a class=\"el\" href=\"" << c.mp_group->get_default_class()->name() << ".html\">" << c.mp_group->name() << "</a>\n";
-			}
-			else
-				ss << "<a class=\"el\" href=\"" << c.name() << ".html\">" << c.name() << "</a>";
-			ss << "</td></tr>\n";
+			if(c.mp_group == NULL) { UG_LOG("neighter group nor class???\n"); }
+			else if(c.mp_group->get_default_class() == NULL) { UG_LOG("no default class\n");  }
+			else out << "<a class=\"el\" href=\"" << c.mp_group->get_default_class()->name() << ".html\">" << c.mp_group->name() << "</a>\n";
 		}
+		else
+			out << "<a class=\"el\" href=\"" << c.name() << ".html\">" << c.name() << "</a>";
+		out << Row(RF_ITEM_END);
+	}
 
-		ss << "</table>";
-		ss << "<h2>Functions</h2>\n";
-		ss << "<table border=0 cellpadding=0 cellspacing=0>"
-									<< "<tr><td></td></tr>";
-		vector<string> vstr;
-		for(size_t i=0; i< it->second.functions.size(); i++)
-		{
-			ExportedFunction *e = it->second.functions[i];
-			vstr.push_back(FunctionInfoHTML(*e, g.c_str()));
-		}
-		remove_doubles(vstr);
-		for(vector<string>::iterator strit = vstr.begin(); strit != vstr.end(); ++strit)
-			ss << *strit;
-		ss << "</table>";
-
-		fstream f(GetFilenameForGroup(g, dir).c_str(), ios::out);
-		WriteHeader(f, (string("Group ")+g).c_str());
-		f << ss.str();
-		WriteFooter(f);
-		groupsstring[it->first] = ss.str();
+	out << "</table>";
+	out << "<h2>Functions</h2>\n";
+	out << "<table border=0 cellpadding=0 cellspacing=0>"
+								<< "<tr><td></td></tr>";
+	vector<string> vstr;
+	for(size_t i=0; i< group.functions.size(); i++)
+	{
+		ExportedFunction *e = group.functions[i];
+		vstr.push_back(FunctionInfoHTML(*e, g.c_str()));
+	}
+	remove_doubles(vstr);
+	for(vector<string>::iterator strit = vstr.begin(); strit != vstr.end(); ++strit)
+		out << *strit;
+	out << "</table>";
+}
+
+/// writes the collapsed entry of a group in groups_index.html
+static void WriteGroupIndexEntry(ostream &out, const string &title, const string &g, const UGRegistryGroup &group)
+{
+	out << "<li data-group=\"" << GetFilenameForGroup(g) << "\">" << title
+		<< " (" << group.classesAndGroups.size() << " classes, " << group.functions.size() << " functions)"
+		<< "<ul></ul>\n";
+}
+
+/// the registry groups selected by the DocuGenFilter
+static void GetSelectedGroups(std::map<string, UGRegistryGroup> &groups)
+{
+	// the groups only reference the class descriptions of the session
+	GetGroups(groups);
+
+	const DocuGenFilter &filter = GetDocuGenFilter();
+	for(map<string, UGRegistryGroup>::iterator it = groups.begin(); it != groups.end(); )
+	{
+		if(filter.group_selected(it->first)) ++it;
+		else groups.erase(it++);
 	}
+}
 
-	fstream indexhtml((string(dir).append("groups_index.html")).c_str(), ios::out);
+static void WriteGroupPage(const char *dir, const string &g, const UGRegistryGroup &group)
+{
+	TraceSpan span("WriteGroups", g);
+	OutputFile f(GetFilenameForGroup(g, dir));
+	WriteHeader(f, (string("Group ")+g).c_str());
+	// groups_index.html loads the part between the markers on expand
+	f << "<!--group-->";
+	WriteGroupHTML(f, g, group);
+	f << "<!--/group-->";
+	WriteFooter(f);
+}
+
+static void WriteGroupsIndexHTML(const char *dir, std::map<string, UGRegistryGroup> &groups)
+{
+	// groups_index.html only lists the groups, clickEventHandler.js fetches
+	// the tables from the group pages when a group is expanded
+	OutputFile indexhtml(string(dir).append("groups_index.html"));
 
-	WriteHeader(indexhtml, "Groups");
+	WriteHeader(indexhtml, "Groups", true);
 	indexhtml << "<h1>Groups</h1>\n";
 	indexhtml << "<ul id=\"LinkedList1\" class=\"LinkedList\">\n";
 	for(map<string, UGRegistryGroup>::iterator it = groups.begin(); it != groups.end(); ++it)
 	{
 		string g = it->first;
 		if(IsPluginGroup(g)==true) continue;
-		string filename = GetFilenameForGroup(g);
 		if(g.compare("") == 0) g = "(empty group)";
-		//indexhtml << "<li><a class=\"el\" href=\"" << filename << "\">" << g << "</a>\n";
-		indexhtml << "<li>" << g << "\n";
-		indexhtml << "<ul><li>" << groupsstring[it->first] << "</ul>\n";
+		WriteGroupIndexEntry(indexhtml, g, it->first, it->second);
 	}
 	indexhtml << "</ul>\n";
 	indexhtml << "<h1>Plugin Groups</h1>\n";
 	indexhtml << "<ul id=\"LinkedList2\" class=\"LinkedList\">\n";
-	//indexhtml << "<ul>";
 	for(map<string, UGRegistryGroup>::iterator it = groups.begin(); it != groups.end(); ++it)
 	{
 		string g = it->first;
 		if(IsPluginGroup(g)==false) continue;
-		string filename = GetFilenameForGroup(g);
-		//indexhtml << "<li><a class=\"el\" href=\"" << filename << "\">" << g << "</a>\n";
-		//indexhtml << "<ul><li>test<li>test2<li>test3</ul>";
-		indexhtml << "<li>" << g << "\n";
-		indexhtml << "<ul><li>" << groupsstring[it->first] << "</ul>\n";
+		WriteGroupIndexEntry(indexhtml, g, it->first, it->second);
 	}
 
 	indexhtml 	<< "</ul>";
 	WriteFooter(indexhtml);
+}
+
+// write one page per group and groups_index.html
+void WriteGroups(const char *dir, std::vector<UGDocuClassDescription> &classesAndGroups)
+{
+	try{
+	UG_LOG("WriteGroups..." << endl);
+//	Registry &reg = GetUGRegistry();
+
+	std::map<string, UGRegistryGroup> groups;
+	GetSelectedGroups(groups);
+
+	// every group page is written as soon as it is rendered, the group pages
+	// are partitioned among the processes
+	ProgressCounter progress("WriteGroups", NumLocalItems(groups.size()));
+	size_t iGroup = 0;
+	for(map<string, UGRegistryGroup>::iterator it = groups.begin(); it != groups.end(); ++it, ++iGroup)
+	{
+		if(!IsLocalItem(iGroup)) continue;
+		DOCUGEN_LOG(LL_VERBOSE, "group '" << it->first << "'\n");
+		progress.step();
+		WriteGroupPage(dir, it->first, it->second);
+	}
+	if(!IsOutputRank()) return;
+
+	WriteGroupsIndexHTML(dir, groups);
 	}UG_CATCH_THROW_FUNC();
 }
 
+bool WriteRegistryGroupPage(const char *dir, const string &g)
+{
+	try{
+	std::map<string, UGRegistryGroup> groups;
+	GetSelectedGroups(groups);
+	map<string, UGRegistryGroup>::iterator it = groups.find(g);
+	if(it == groups.end()) return false;
+	WriteGroupPage(dir, it->first, it->second);
+	return true;
+	}UG_CATCH_THROW_FUNC();
+	return false;
+}
+
+void WriteGroupsIndex(const char *dir)
+{
+	try{
+	std::map<string, UGRegistryGroup> groups;
+	GetSelectedGroups(groups);
+	WriteGroupsIndexHTML(dir, groups);
+	}UG_CATCH_THROW_FUNC();
+}
+
+
+class FunctionIndexRowRenderer
+{
+public:
+	FunctionIndexRowRenderer(const vector<const ExportedFunction*> &functions)
+		: m_functions(functions), m_bAnchored(functions.size(), false)
+	{
+		// the first overload of each name, rows are rendered in parallel
+		set<string> names;
+		for(size_t i=0; i<functions.size(); i++)
+			m_bAnchored[i] = names.insert(functions[i]->name()).second;
+	}
+	string operator()(size_t i)
+	{
+		const ExportedFunction &f = *m_functions[i];
+		string html = FunctionInfoHTML(f, f.group().c_str());
+		return m_bAnchored[i] ? AnchoredFunctionInfoHTML(f.name(), html) : html;
+	}
+
+private:
+	const vector<const ExportedFunction*> &m_functions;
+	vector<bool> m_bAnchored;
+};
+
+string GetFunctionIndexPage(const string &functionName)
+{
+	if(GetDocuGenOptions().indexShards)
+		return IndexShardFilename("functions", LetterShardKey(functionName));
+	return "functions.html";
+}
 
 // write functions index
 template<typename TSortFunction>
 void WriteGlobalFunctions(const char *dir, const char *filename,
-		TSortFunction sortFunction)
+		TSortFunction sortFunction, bool bGroup)
 {
 	try{
 	UG_LOG("WriteGlobalFunctions (" << filename << ") ... ");
 	Registry &reg = GetUGRegistry();
 
+	const DocuGenFilter &filter = GetDocuGenFilter();
 	std::vector<const bridge::ExportedFunction *> sortedFunctions;
 	for(size_t i=0; i<reg.num_functions(); i++)
 	{
 		ExportedFunctionGroup &fu = reg.get_function_group(i);
 		for(size_t j=0; j<fu.num_overloads(); j++)
-			sortedFunctions.push_back(fu.get_overload(j));
+			if(filter.function_selected(fu.get_overload(j)))
+				sortedFunctions.push_back(fu.get_overload(j));
 	}
 	sort(sortedFunctions.begin(), sortedFunctions.end(), sortFunction);
 
-	fstream funchtml((string(dir).append(filename)).c_str(), ios::out);
+	FunctionIndexRowRenderer renderer(sortedFunctions);
+
+	// one page per registry group or first letter
+	if(GetDocuGenOptions().indexShards)
+	{
+		string base = string(filename).substr(0, strlen(filename)-5);
+		vector<IndexShard> shards;
+		map<string, size_t> shardOfKey;
+		for(size_t i=0; i<sortedFunctions.size(); i++)
+			AddToIndexShards(shards, shardOfKey, base, bGroup ? sortedFunctions[i]->group() : LetterShardKey(sortedFunctions[i]->name()), i);
+		WriteShardedIndex(dir, filename, bGroup ? "Global Functions Index by Group" : "Global Functions Index",
+				shards, renderer, true);
+		UG_LOG(sortedFunctions.size() << " functions written to " << shards.size() << " pages." << endl);
+		return;
+	}
+
+	OutputFile funchtml(string(dir).append(filename));
 	WriteHeader(funchtml, "Global Functions Index by Group");
 	funchtml 	<< "<table border=0 cellpadding=0 cellspacing=0>"
 				<< "<tr><td></td></tr>";
 	vector<string> vstr;
 	for(size_t i=0; i<sortedFunctions.size(); i++)
-		vstr.push_back(FunctionInfoHTML(*sortedFunctions[i], sortedFunctions[i]->group().c_str()));
+		vstr.push_back(renderer(i));
 	remove_doubles(vstr);
 	for(vector<string>::iterator it = vstr.begin(); it != vstr.end(); ++it)
 		funchtml << *it;
 	funchtml 	<< "</table>";
 	WriteFooter(funchtml);
 
-	UG_LOG(reg.num_functions() << " functions written." << endl);
+	UG_LOG(sortedFunctions.size() << " functions written." << endl);
 	}UG_CATCH_THROW_FUNC();
 }
 
+void WriteGlobalFunctionIndices(const char *dir)
+{
+	WriteGlobalFunctions(dir, "functions.html", ExportedFunctionsSort, false);
+	WriteGlobalFunctions(dir, "groupedfunctions.html", ExportedFunctionsGroupSort, true);
+}
+
+
+/// DistributedParallelFor body writing the page of the i-th selected class
+class WriteClassHTMLBody
+{
+public:
+	WriteClassHTMLBody(const char *dir, std::vector<UGDocuClassDescription> &classes,
+			const std::vector<const IExportedClass*> &pageClasses, ClassHierarchy &hierarchy)
+		: m_dir(dir), m_classes(classes), m_pageClasses(pageClasses), m_hierarchy(hierarchy),
+		  m_progress("WriteClassHTML", NumLocalItems(pageClasses.size())) {}
+
+	void operator()(size_t i, size_t thread)
+	{
+		const IExportedClass &c = *m_pageClasses[i];
+		DOCUGEN_LOG(LL_VERBOSE, "class '" << c.name() << "'\n");
+		WriteClassHTML(m_dir, GetUGDocuClassDescription(m_classes, &c), m_hierarchy);
+		m_progress.step();
+	}
+
+private:
+	const char *m_dir;
+	std::vector<UGDocuClassDescription> &m_classes;
+	const std::vector<const IExportedClass*> &m_pageClasses;
+	ClassHierarchy &m_hierarchy;
+	ProgressCounter m_progress;
+};
 
 void WriteHTMLDocu(std::vector<UGDocuClassDescription> &classes, std::vector<UGDocuClassDescription> &classesAndGroups, const char *dir, ClassHierarchy &hierarchy)
 {
 	try{
 	Registry &reg = GetUGRegistry();
 
-	WriteUGDocuCSS(dir);
+	// with several processes, the class and group pages are partitioned
+	// and the output rank writes all other files
+	bool bOutputRank = IsOutputRank();
+	const DocuGenFilter &filter = GetDocuGenFilter();
+
+	if(bOutputRank)
+	{
+		PhaseTimer phase("WriteAssets");
+		WriteAssets(dir);
+	}
+
+	// one data file and the viewer instead of the pages below
+	if(GetDocuGenOptions().singlePage)
+	{
+		if(bOutputRank)
+		{
+			PhaseTimer phase("WriteSinglePageDocu");
+			WriteSinglePageDocu(dir, classesAndGroups, hierarchy);
+		}
+		UG_LOG("done." << endl);
+		return;
+	}
 
-	UG_LOG("WriteClassHierarchy... ");
-	WriteClassHierarchy(dir, hierarchy);
+	if(bOutputRank)
+	{
+		PhaseTimer phase("WriteClassHierarchy");
+		UG_LOG("WriteClassHierarchy... ");
+		WriteClassHierarchy(dir, hierarchy);
+	}
 
 	// write html file for each class
-	UG_LOG(endl << "WriteClasses... ");
-	for(size_t i=0; i<reg.num_classes(); ++i)
-		WriteClassHTML(dir, GetUGDocuClassDescription(classes, &reg.get_class(i)), hierarchy);
-	UG_LOG(reg.num_classes() << " classes written." << endl);
-
-	WriteClassIndex(dir, classesAndGroups, false);
-	WriteClassIndex(dir, classesAndGroups, true);
-	WriteGroups(dir, classesAndGroups);
+	{
+		PhaseTimer phase("WriteClassHTML");
+		UG_LOG(endl << "WriteClasses... " << endl);
+		vector<const IExportedClass*> pageClasses;
+		for(size_t i=0; i<reg.num_classes(); i++)
+			if(filter.class_selected(&reg.get_class(i)))
+				pageClasses.push_back(&reg.get_class(i));
+		{
+			WriteClassHTMLBody body(dir, classes, pageClasses, hierarchy);
+			DistributedParallelFor(pageClasses.size(), body);
+		}
+		UG_LOG(NumLocalItems(pageClasses.size()) << " classes written." << endl);
+	}
+
+	// the indices only list the selected classes and class groups
+	vector<UGDocuClassDescription> selectedClassesAndGroups;
+	if(filter.is_active())
+	{
+		for(size_t i=0; i<classesAndGroups.size(); i++)
+			if(filter.description_selected(classesAndGroups[i]))
+				selectedClassesAndGroups.push_back(classesAndGroups[i]);
+	}
+	vector<UGDocuClassDescription> &indexClasses = filter.is_active() ? selectedClassesAndGroups : classesAndGroups;
+
+	if(bOutputRank)
+	{
+		PhaseTimer phase("WriteClassIndex");
+		WriteClassIndex(dir, indexClasses, false);
+		WriteClassIndex(dir, indexClasses, true);
+	}
+	{
+		PhaseTimer phase("WriteGroups");
+		WriteGroups(dir, indexClasses);
+	}
 	//WriteGroupClassIndex(dir, classesAndGroups);
 
-	WriteGlobalFunctions(dir, "functions.html", ExportedFunctionsSort);
-	WriteGlobalFunctions(dir, "groupedfunctions.html", ExportedFunctionsGroupSort);
+	if(bOutputRank)
+	{
+		PhaseTimer phase("WriteSearchIndex");
+		WriteSearchIndex(dir);
+	}
+
+	if(bOutputRank)
+	{
+		PhaseTimer phase("WriteGlobalFunctions");
+		WriteGlobalFunctionIndices(dir);
+	}
 
 	UG_LOG("done." << endl);
 	}UG_CATCH_THROW_FUNC();
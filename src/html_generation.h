@@ -47,9 +47,20 @@ namespace DocuGen
 /// \addtogroup apps_ugdocu
 /// \{
 
-void WriteHeader(std::fstream &file, const std::string &title);
-void WriteFooter(std::fstream &file);
-void WriteUGDocuCSS(const char *dir);
+/// bTreeScript includes clickEventHandler.js for the lists LinkedList1/2
+void WriteHeader(std::ostream &file, const std::string &title, bool bTreeScript = false);
+void WriteFooter(std::ostream &file);
+
+/// name with the content hash before the extension, e.g. ugdocu.1a2b3c4d.css
+std::string AssetFilename(const std::string &name, const unsigned char *data, size_t len);
+/**
+ * \brief writes an embedded file under its AssetFilename
+ * \details The name changes with the content, so pages referencing it can
+ *   be cached indefinitely and an existing file is not written again.
+ */
+void WriteAsset(const char *dir, const std::string &name, const unsigned char *data, size_t len);
+const std::string &UGDocuCSSFilename();
+void WriteAssets(const char *dir);
 std::string ConstructorInfoHTML(std::string classname, const bridge::ExportedConstructor &thefunc,	std::string group);
 std::string FunctionInfoHTML(const bridge::ExportedFunctionBase &thefunc, const bridge::IExportedClass *c = NULL, bool bConst = false);
 std::string FunctionInfoHTML(const bridge::ExportedFunctionBase &thefunc,	const char *group);
@@ -60,6 +71,14 @@ void WriteClassHierarchy(const char *dir, bridge::ClassHierarchy &hierarchy);
 void WriteClassHTML(const char *dir, UGDocuClassDescription *d, bridge::ClassHierarchy &hierarchy);
 void WriteClassIndex(const char *dir, std::vector<UGDocuClassDescription> &classesAndGroups, bool bGroup);
 
+/// page of functions.html (or its letter shard) listing the global function functionName
+std::string GetFunctionIndexPage(const std::string &functionName);
+/// functions.html and groupedfunctions.html (or their shards)
+void WriteGlobalFunctionIndices(const char *dir);
+/// the page of the registry group g, false if there is no such group or it is not selected
+bool WriteRegistryGroupPage(const char *dir, const std::string &g);
+/// groups_index.html without the group pages
+void WriteGroupsIndex(const char *dir);
 //void WriteGlobalFunctions(const char *dir, const char *filename, bool sortFunction(const bridge::ExportedFunction *,const bridge::ExportedFunction *j));
 
 void WriteHTMLDocu(std::vector<UGDocuClassDescription> &classes, std::vector<UGDocuClassDescription> &classesAndGroups, const char *dir, bridge::ClassHierarchy &hierarchy);
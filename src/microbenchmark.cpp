@@ -0,0 +1,369 @@
+/*
+ * Copyright (c) 2013-2016:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common/log.h"
+#include "common/error.h"
+#include "registry/registry.h"
+#include "registry/class_helper.h"
+#include "common/util/file_util.h"
+
+#include "ugdocu_misc.h"
+#include "html_generation.h"
+#include "class_hierarchy_provider.h"
+#include "cpp_generator.h"
+#include "microbenchmark.h"
+
+using namespace std;
+
+namespace ug
+{
+
+namespace DocuGen
+{
+
+using namespace bridge;
+
+static AllocationCounter allocationCounter = NULL;
+
+void SetAllocationCounter(AllocationCounter counter)
+{
+	allocationCounter = counter;
+}
+
+/// discards everything, so only the rendering itself is measured
+class NullBuffer : public std::streambuf
+{
+protected:
+	virtual int_type overflow(int_type c) { return traits_type::not_eof(c); }
+	virtual std::streamsize xsputn(const char *, std::streamsize n) { return n; }
+};
+
+/// calls op in doubling batches until minMS milliseconds have passed
+template<typename TOperation>
+static MicrobenchmarkResult Measure(const string &name, TOperation &op, double minMS)
+{
+	MicrobenchmarkResult res;
+	res.name = name;
+	op();	// warm up
+
+	double elapsedNS = 0;
+	size_t allocations = 0;
+	for(size_t batch = 1; elapsedNS < minMS * 1e6; batch *= 2)
+	{
+		size_t allocationsStart = allocationCounter ? allocationCounter() : 0;
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		for(size_t i=0; i<batch; i++)
+			op();
+		elapsedNS += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+		if(allocationCounter)
+			allocations += allocationCounter() - allocationsStart;
+		res.iterations += batch;
+	}
+	res.nsPerCall = elapsedNS / res.iterations;
+	UG_LOG(left << setw(48) << name << right << setw(12) << fixed << setprecision(1) << res.nsPerCall << " ns");
+	if(allocationCounter)
+	{
+		res.allocationsPerCall = (double) allocations / res.iterations;
+		UG_LOG(setw(10) << setprecision(2) << res.allocationsPerCall << " allocs");
+	}
+	UG_LOG("\n");
+	return res;
+}
+
+// the operations below keep a checksum of their results, so that nothing can be optimized away
+
+struct FunctionInfoHTMLOp
+{
+	const ExportedFunctionBase *func; const char *group; size_t checksum;
+	void operator()() { checksum += FunctionInfoHTML(*func, group).size(); }
+};
+
+struct MethodInfoHTMLOp
+{
+	const ExportedFunctionBase *method; const IExportedClass *cls; size_t checksum;
+	void operator()() { checksum += FunctionInfoHTML(*method, cls, false).size(); }
+};
+
+struct ConstructorInfoHTMLOp
+{
+	const ExportedConstructor *ctor; const IExportedClass *cls; size_t checksum;
+	void operator()() { checksum += ConstructorInfoHTML(cls->name(), *ctor, cls->group()).size(); }
+};
+
+struct WriteParametersInOp
+{
+	const ExportedFunctionBase *func; std::ostream *out;
+	void operator()() { WriteParametersIn(*out, *func); }
+};
+
+struct WriteParametersOutOp
+{
+	const ExportedFunctionBase *func; std::ostream *out;
+	void operator()() { WriteParametersOut(*out, *func); }
+};
+
+struct ParameterToStringOp
+{
+	const ExportedFunctionBase *func; std::ostream *out;
+	void operator()()
+	{
+		for(size_t i=0; i<func->params_in().size(); i++)
+			ParameterToString(*out, func->params_in(), i, true);
+	}
+};
+
+struct GetClassGroupOp
+{
+	string classname; size_t checksum;
+	void operator()() { checksum += GetClassGroup(classname).size(); }
+};
+
+/// includes copying the input, remove_doubles works in place
+struct RemoveDoublesOp
+{
+	const vector<string> *input; size_t checksum;
+	void operator()()
+	{
+		vector<string> v = *input;
+		remove_doubles(v);
+		checksum += v.size();
+	}
+};
+
+struct WriteClassUsageExactOp
+{
+	string classname; std::ostream *out;
+	void operator()() { WriteClassUsageExact("", *out, classname.c_str(), false); }
+};
+
+/// has access to the private parameter rendering of CppGenerator
+class CppGeneratorMicrobenchmark
+{
+public:
+	struct ParameterToStringOp
+	{
+		CppGenerator *gen; const ExportedFunctionBase *func; size_t checksum;
+		void operator()()
+		{
+			for(size_t i=0; i<func->params_in().size(); i++)
+				checksum += gen->parameter_to_string(func->params_in(), i).size();
+		}
+	};
+
+	struct GenerateParameterListOp
+	{
+		CppGenerator *gen; const ExportedFunctionBase *func; size_t checksum;
+		void operator()() { checksum += gen->generate_parameter_list(*func).size(); }
+	};
+
+	static void run(vector<MicrobenchmarkResult> &results, const ExportedFunctionBase *func, double minMS)
+	{
+		ClassHierarchyProvider chp;
+		chp.init(GetUGRegistry());
+		CppGenerator gen("", chp, true);
+
+		ParameterToStringOp paramOp = { &gen, func, 0 };
+		results.push_back(Measure("CppGenerator::parameter_to_string", paramOp, minMS));
+		GenerateParameterListOp listOp = { &gen, func, 0 };
+		results.push_back(Measure("CppGenerator::generate_parameter_list", listOp, minMS));
+	}
+};
+
+/// first registered class used as parameter of func, "" if there is none
+static string ClassInParameters(const ExportedFunctionBase &func)
+{
+	const ParameterInfo &par = func.params_in();
+	for(size_t i=0; i<par.size(); i++)
+		if(par.class_name(i) != NULL)
+			return par.class_name(i);
+	return "";
+}
+
+void RunMicrobenchmarks(vector<MicrobenchmarkResult> &results, double minMS)
+{
+	try{
+	Registry &reg = GetUGRegistry();
+	NullBuffer nullBuffer;
+	std::ostream nullStream(&nullBuffer);
+
+	// representative objects: the function, method and constructor with the most parameters
+	const ExportedFunction *func = NULL;
+	for(size_t i=0; i<reg.num_functions(); i++)
+		if(func == NULL || reg.get_function(i).params_in().size() > func->params_in().size())
+			func = &reg.get_function(i);
+
+	const ExportedMethod *method = NULL;
+	const IExportedClass *methodClass = NULL;
+	const ExportedConstructor *ctor = NULL;
+	const IExportedClass *ctorClass = NULL;
+	for(size_t i=0; i<reg.num_classes(); i++)
+	{
+		const IExportedClass &c = reg.get_class(i);
+		for(size_t j=0; j<c.num_methods(); j++)
+		{
+			const ExportedMethodGroup &grp = c.get_method_group(j);
+			for(size_t k=0; k<grp.num_overloads(); k++)
+				if(method == NULL || grp.get_overload(k)->params_in().size() > method->params_in().size())
+				{
+					method = grp.get_overload(k);
+					methodClass = &c;
+				}
+		}
+		for(size_t j=0; j<c.num_constructors(); j++)
+			if(ctor == NULL || c.get_constructor(j).num_parameter() > ctor->num_parameter())
+			{
+				ctor = &c.get_constructor(j);
+				ctorClass = &c;
+			}
+	}
+
+	string usedClass;
+	if(func != NULL) usedClass = ClassInParameters(*func);
+	if(usedClass.empty() && method != NULL) usedClass = ClassInParameters(*method);
+	if(usedClass.empty() && reg.num_classes() > 0) usedClass = reg.get_class(0).name();
+
+	string groupClass = usedClass;
+	if(reg.num_class_groups() > 0 && reg.get_class_group(0)->num_classes() > 0)
+		groupClass = reg.get_class_group(0)->get_class(0)->name();
+
+	UG_LOG("Microbenchmarks (" << minMS << " ms each):\n");
+
+	if(func != NULL)
+	{
+		FunctionInfoHTMLOp funcOp = { func, func->group().c_str(), 0 };
+		results.push_back(Measure("FunctionInfoHTML (function)", funcOp, minMS));
+		WriteParametersInOp inOp = { func, &nullStream };
+		results.push_back(Measure("WriteParametersIn", inOp, minMS));
+		WriteParametersOutOp outOp = { func, &nullStream };
+		results.push_back(Measure("WriteParametersOut", outOp, minMS));
+		ParameterToStringOp paramOp = { func, &nullStream };
+		results.push_back(Measure("ParameterToString (all parameters)", paramOp, minMS));
+		CppGeneratorMicrobenchmark::run(results, func, minMS);
+
+		// the functions of one group, each twice, as collected by WriteGroups
+		vector<string> groupFunctions;
+		for(size_t i=0; i<reg.num_functions() && groupFunctions.size() < 128; i++)
+			if(reg.get_function(i).group() == func->group())
+				groupFunctions.push_back(FunctionInfoHTML(reg.get_function(i), func->group().c_str()));
+		groupFunctions.insert(groupFunctions.end(), groupFunctions.begin(), groupFunctions.end());
+		RemoveDoublesOp doublesOp = { &groupFunctions, 0 };
+		stringstream ss;
+		ss << "remove_doubles (" << groupFunctions.size() << " entries)";
+		results.push_back(Measure(ss.str(), doublesOp, minMS));
+	}
+	else
+		UG_LOG("no registered functions, skipping function benchmarks.\n");
+
+	if(method != NULL)
+	{
+		MethodInfoHTMLOp methodOp = { method, methodClass, 0 };
+		results.push_back(Measure("FunctionInfoHTML (method)", methodOp, minMS));
+	}
+	if(ctor != NULL)
+	{
+		ConstructorInfoHTMLOp ctorOp = { ctor, ctorClass, 0 };
+		results.push_back(Measure("ConstructorInfoHTML", ctorOp, minMS));
+	}
+
+	if(!usedClass.empty())
+	{
+		GetClassGroupOp groupOp = { groupClass, 0 };
+		results.push_back(Measure("GetClassGroup", groupOp, minMS));
+		WriteClassUsageExactOp usageOp = { usedClass, &nullStream };
+		results.push_back(Measure("WriteClassUsageExact", usageOp, minMS));
+	}
+	}UG_CATCH_THROW_FUNC();
+}
+
+void WriteMicrobenchmarkReport(const string &filename, const vector<MicrobenchmarkResult> &results)
+{
+	try{
+	ofstream f(filename.c_str());
+	if(!f) UG_THROW("could not open '" << filename << "' for writing.");
+
+	f << "{\n\"microbenchmarks\": [\n";
+	for(size_t i=0; i<results.size(); i++)
+	{
+		if(i > 0) f << ",\n";
+		f << "{\"name\": \"" << JSONStringEscape(results[i].name) << "\""
+		  << ", \"iterations\": " << results[i].iterations
+		  << ", \"nsPerCall\": " << results[i].nsPerCall
+		  << ", \"allocationsPerCall\": ";
+		if(results[i].allocationsPerCall < 0) f << "null";
+		else f << results[i].allocationsPerCall;
+		f << "}";
+	}
+	f << "\n]\n}\n";
+	UG_LOG("Wrote microbenchmark report to " << filename << "\n");
+	}UG_CATCH_THROW_FUNC();
+}
+
+void AppendScalingReport(const string &filename, const vector<ScalingResult> &results)
+{
+	try{
+	bool bNew = !FileExists(filename.c_str());
+	ofstream f(filename.c_str(), ios::app);
+	if(!f) UG_THROW("could not open '" << filename << "' for writing.");
+	if(bNew)
+		f << "registry,classes,functions,threads,phase,wall_ms,cpu_ms,files,bytes,"
+			"pages_per_s,mb_per_s,process_peak_rss_kb,speedup,efficiency\n";
+
+	for(size_t i=0; i<results.size(); i++)
+	{
+		const ScalingResult &r = results[i];
+		const ScalingResult *base = &r;
+		for(size_t j=0; j<results.size(); j++)
+			if(results[j].phase == r.phase && results[j].threads < base->threads)
+				base = &results[j];
+
+		double seconds = r.wallMS / 1000.0;
+		double speedup = r.wallMS > 0 ? base->wallMS / r.wallMS : 0;
+		f << "\"" << r.registry << "\"," << r.numClasses << "," << r.numFunctions << "," << r.threads
+		  << ",\"" << r.phase << "\"," << r.wallMS << "," << r.cpuMS << "," << r.filesCreated << "," << r.bytesWritten
+		  << "," << (seconds > 0 ? r.filesCreated / seconds : 0)
+		  << "," << (seconds > 0 ? r.bytesWritten / seconds / 1e6 : 0)
+		  << "," << r.peakRSSKB
+		  << "," << speedup
+		  << "," << speedup * base->threads / r.threads << "\n";
+	}
+	UG_LOG("Appended " << results.size() << " rows to " << filename << "\n");
+	}UG_CATCH_THROW_FUNC();
+}
+
+}	// namespace DocuGen
+}	// namespace ug
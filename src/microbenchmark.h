@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2013-2016:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __UG__DOCUGEN__MICROBENCHMARK_H
+#define __UG__DOCUGEN__MICROBENCHMARK_H
+
+#include <string>
+#include <vector>
+
+namespace ug
+{
+namespace DocuGen
+{
+
+/// \addtogroup apps_ugdocu
+/// \{
+
+/// timing of one measured operation
+class MicrobenchmarkResult
+{
+public:
+	MicrobenchmarkResult() : iterations(0), nsPerCall(0), allocationsPerCall(-1) {}
+
+	std::string name;
+	size_t iterations;
+	double nsPerCall;
+	double allocationsPerCall;	///< calls of operator new per call, -1 if not counted
+};
+
+/// number of calls of operator new so far
+typedef size_t (*AllocationCounter)();
+
+/**
+ * \brief Counts the allocations of the measured operations with counter
+ * \details Counting needs a replaced operator new, which only the
+ *   docugenMicrobenchmarkRunner executable (microbenchmark_main.cpp) has, the
+ *   plugin never replaces the allocator of ugshell. Without a counter
+ *   (NULL, the default) only the times are measured.
+ */
+void SetAllocationCounter(AllocationCounter counter);
+
+/**
+ * \brief Measures the rendering hot paths on objects of the current registry
+ * \details Measured are FunctionInfoHTML, ConstructorInfoHTML,
+ *   WriteParametersIn/Out, ParameterToString, CppGenerator::parameter_to_string,
+ *   CppGenerator::generate_parameter_list, GetClassGroup, remove_doubles and
+ *   WriteClassUsageExact. Every operation is repeated for at least minMS
+ *   milliseconds.
+ *   GetGroups and InitUG have to be called before.
+ */
+void RunMicrobenchmarks(std::vector<MicrobenchmarkResult> &results, double minMS=200);
+
+/// writes the results as JSON
+void WriteMicrobenchmarkReport(const std::string &filename, const std::vector<MicrobenchmarkResult> &results);
+
+/// one phase of one run of the scaling benchmark
+class ScalingResult
+{
+public:
+	ScalingResult() : numClasses(0), numFunctions(0), threads(0), wallMS(0), cpuMS(0),
+		filesCreated(0), bytesWritten(0), peakRSSKB(0) {}
+
+	std::string registry;	///< options of the synthetic registry
+	size_t numClasses;
+	size_t numFunctions;
+	size_t threads;
+	std::string phase;
+	double wallMS;
+	double cpuMS;
+	size_t filesCreated;
+	size_t bytesWritten;
+	long peakRSSKB;			///< peak resident set size of the process, including earlier runs
+};
+
+/**
+ * \brief Appends results as CSV rows to filename, writes a header if the file is new
+ * \details Besides the measured values, pages/s, MB/s, speedup and parallel
+ *   efficiency are written. Speedup and efficiency of a phase are relative to
+ *   the run of the same phase with the fewest threads among results.
+ */
+void AppendScalingReport(const std::string &filename, const std::vector<ScalingResult> &results);
+
+// end group apps_ugdocu
+/// \}
+
+}	// namespace DocuGen
+
+/// defined in ugdocu.cpp, also registered for ugshell
+int RunDocuGenMicrobenchmarks(const char* synthOptions, const char* reportFile);
+
+}	// namespace ug
+
+#endif	// __UG__DOCUGEN__MICROBENCHMARK_H
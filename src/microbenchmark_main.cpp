@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2013-2016:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+// docugenMicrobenchmarkRunner: runs RunDocuGenMicrobenchmarks with allocation
+// counting. Counting replaces the global operator new, which is only done in
+// this executable, never in the plugin loaded into ugshell.
+//
+//     docugenMicrobenchmarkRunner [synthOptions [reportFile]]
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+#include "ug.h"
+#include "common/util/path_provider.h"
+#include "common/util/plugin_util.h"
+#include "bridge/bridge.h"
+
+#include "microbenchmark.h"
+
+/// calls of operator new in this process
+static std::atomic<size_t> numAllocations(0);
+
+static size_t NumAllocations()
+{
+	return numAllocations.load(std::memory_order_relaxed);
+}
+
+static void *CountedAllocation(std::size_t size)
+{
+	numAllocations.fetch_add(1, std::memory_order_relaxed);
+	return malloc(size == 0 ? 1 : size);
+}
+
+// all replaceable forms, so that every new is paired with the matching delete
+
+void *operator new(std::size_t size)
+{
+	void *p = CountedAllocation(size);
+	if(p == NULL) throw std::bad_alloc();
+	return p;
+}
+
+void *operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+	return CountedAllocation(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+	return CountedAllocation(size);
+}
+
+void operator delete(void *p) noexcept { free(p); }
+void operator delete[](void *p) noexcept { free(p); }
+void operator delete(void *p, const std::nothrow_t &) noexcept { free(p); }
+void operator delete[](void *p, const std::nothrow_t &) noexcept { free(p); }
+
+#ifdef __cpp_sized_deallocation
+void operator delete(void *p, std::size_t) noexcept { free(p); }
+void operator delete[](void *p, std::size_t) noexcept { free(p); }
+#endif
+
+#ifdef __cpp_aligned_new
+static void *CountedAlignedAllocation(std::size_t size, std::align_val_t alignment)
+{
+	numAllocations.fetch_add(1, std::memory_order_relaxed);
+	void *p = NULL;
+	size_t align = static_cast<size_t>(alignment);
+	if(posix_memalign(&p, align < sizeof(void*) ? sizeof(void*) : align, size == 0 ? 1 : size) != 0)
+		return NULL;
+	return p;
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment)
+{
+	void *p = CountedAlignedAllocation(size, alignment);
+	if(p == NULL) throw std::bad_alloc();
+	return p;
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment)
+{
+	return operator new(size, alignment);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+	return CountedAlignedAllocation(size, alignment);
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+	return CountedAlignedAllocation(size, alignment);
+}
+
+void operator delete(void *p, std::align_val_t) noexcept { free(p); }
+void operator delete[](void *p, std::align_val_t) noexcept { free(p); }
+void operator delete(void *p, std::size_t, std::align_val_t) noexcept { free(p); }
+void operator delete[](void *p, std::size_t, std::align_val_t) noexcept { free(p); }
+void operator delete(void *p, std::align_val_t, const std::nothrow_t &) noexcept { free(p); }
+void operator delete[](void *p, std::align_val_t, const std::nothrow_t &) noexcept { free(p); }
+#endif
+
+int main(int argc, char **argv)
+{
+	const char *synthOptions = argc > 1 ? argv[1] : "";
+	const char *reportFile = argc > 2 ? argv[2] : "docugen_microbenchmarks.json";
+
+	ug::UGInit(&argc, &argv);
+	ug::LoadPlugins(ug::PathProvider::get_path(ug::PLUGIN_PATH).c_str(), "ug4/", ug::bridge::GetUGRegistry());
+
+	ug::DocuGen::SetAllocationCounter(&NumAllocations);
+	int res = ug::RunDocuGenMicrobenchmarks(synthOptions, reportFile);
+	ug::DocuGen::SetAllocationCounter(NULL);
+
+	ug::UGFinalize();
+	return res;
+}
@@ -0,0 +1,358 @@
+/*
+ * Copyright (c) 2013-2016:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "common/log.h"
+#include "common/error.h"
+#include "common/util/file_util.h"
+
+#include "output_file.h"
+#include "output_sink.h"
+#include "ugdocu_profiling.h"
+#include "ugdocu_options.h"
+#include "ugdocu_misc.h"
+
+#ifdef UG_DOCUGEN_ZLIB
+#	include <zlib.h>
+#endif
+
+using namespace std;
+
+namespace ug
+{
+namespace DocuGen
+{
+
+void OutputFileBuffer::spill()
+{
+	spillFile.write(data.data(), data.size());
+	bytesSpilled += data.size();
+	data.clear();
+}
+
+OutputFileBuffer::int_type OutputFileBuffer::overflow(int_type c)
+{
+	if(!traits_type::eq_int_type(c, traits_type::eof()))
+		data.push_back(traits_type::to_char_type(c));
+	if(maxBuffered > 0 && data.size() >= maxBuffered)
+		spill();
+	return traits_type::not_eof(c);
+}
+
+streamsize OutputFileBuffer::xsputn(const char *s, streamsize n)
+{
+	data.append(s, n);
+	if(maxBuffered > 0 && data.size() >= maxBuffered)
+		spill();
+	return n;
+}
+
+OutputFile::OutputFile() :
+	  std::ostream( NULL )
+	, m_bOpen( false )
+{
+	rdbuf(&m_buffer);
+}
+
+OutputFile::OutputFile(const string &filename) :
+	  std::ostream( NULL )
+	, m_bOpen( false )
+{
+	rdbuf(&m_buffer);
+	open(filename);
+}
+
+OutputFile::~OutputFile()
+{
+	try{
+		close();
+	}
+	catch(UGError &err)
+	{
+		UG_ERR_LOG(err.get_msg(0) << "\n");
+	}
+}
+
+void OutputFile::open(const string &filename)
+{
+	close();
+	m_filename = filename;
+	m_buffer.data.clear();
+	m_bOpen = true;
+	clear();
+}
+
+static void ForgetWrittenFile(const string &filename);
+
+size_t CompressedFileSize(const string &filename)
+{
+	ifstream f((filename + ".gz").c_str(), ios::in | ios::binary | ios::ate);
+	if(!f) return 0;
+	return (size_t) f.tellg();
+}
+
+static bool GzipSidecarWanted(size_t size)
+{
+	const DocuGenOptions &opt = GetDocuGenOptions();
+	return opt.gzip && size >= opt.gzipMinSize;
+}
+
+bool NeedsGzipSidecar(const string &filename, size_t size)
+{
+	return GetOutputSink().is_file_system() && GzipSidecarWanted(size)
+			&& !FileExists((filename + ".gz").c_str());
+}
+
+bool OutputFileExists(const string &filename)
+{
+	return GetOutputSink().is_file_system() && FileExists(filename.c_str());
+}
+
+/// files whose sidecar filename.gz was written by this process
+static set<string> gzipSidecars;
+static std::mutex gzipSidecarsMutex;
+
+/**
+ * removes the sidecar of a file which doesn't get one. Without the option
+ * gzip, only sidecars written by this process are removed, so that plain
+ * runs don't try to remove a sidecar of every file.
+ */
+static void RemoveGzipSidecar(const string &filename)
+{
+	bool bOwn;
+	{
+		std::lock_guard<std::mutex> lock(gzipSidecarsMutex);
+		bOwn = gzipSidecars.erase(filename) > 0;
+	}
+	// with gzip, an earlier run may have compressed a file which is now too small
+	if(bOwn || GetDocuGenOptions().gzip)
+		remove((filename + ".gz").c_str());
+}
+
+#ifdef UG_DOCUGEN_ZLIB
+static void RememberGzipSidecar(const string &filename)
+{
+	std::lock_guard<std::mutex> lock(gzipSidecarsMutex);
+	gzipSidecars.insert(filename);
+}
+
+/// gzip writer of filename.gz, removes the incomplete file on errors
+class GzipSidecar
+{
+public:
+	GzipSidecar(const string &filename) : m_filename(filename + ".gz")
+	{
+		m_gz = gzopen(m_filename.c_str(), "wb");
+		if(m_gz == NULL)
+			UG_THROW("could not open '" << m_filename << "' for writing.");
+	}
+
+	~GzipSidecar()
+	{
+		if(m_gz != NULL)
+		{
+			gzclose(m_gz);
+			remove(m_filename.c_str());
+		}
+	}
+
+	void write(const char *data, size_t size)
+	{
+		while(size > 0)
+		{
+			// gzwrite takes unsigned sizes
+			unsigned chunk = (unsigned) min(size, (size_t) 1 << 30);
+			if(gzwrite(m_gz, data, chunk) != (int) chunk)
+				UG_THROW("could not write '" << m_filename << "'.");
+			data += chunk;
+			size -= chunk;
+		}
+	}
+
+	void close()
+	{
+		int err = gzclose(m_gz);
+		m_gz = NULL;
+		if(err != Z_OK)
+		{
+			remove(m_filename.c_str());
+			UG_THROW("could not write '" << m_filename << "'.");
+		}
+		RecordSidecarWritten(CompressedFileSize(m_filename.substr(0, m_filename.size()-3)));
+		RememberGzipSidecar(m_filename.substr(0, m_filename.size()-3));
+	}
+
+private:
+	string m_filename;
+	gzFile m_gz;
+};
+#endif
+
+/**
+ * writes filename.gz if the option gzip is set and the file is at least
+ * gzipMinSize bytes large, otherwise removes an outdated one (see
+ * RemoveGzipSidecar). Called by the
+ * thread which finished the file, so pages are compressed in parallel.
+ */
+static void UpdateGzipSidecar(const string &filename, const char *data, size_t size)
+{
+	if(!GzipSidecarWanted(size))
+	{
+		RemoveGzipSidecar(filename);
+		return;
+	}
+#ifdef UG_DOCUGEN_ZLIB
+	TraceSpan span("gzip", filename);
+	GzipSidecar gz(filename);
+	gz.write(data, size);
+	gz.close();
+#endif
+}
+
+/// same for a file streamed to disk, which is read back in chunks
+static void UpdateGzipSidecarOfFile(const string &filename, size_t size)
+{
+	if(!GzipSidecarWanted(size))
+	{
+		RemoveGzipSidecar(filename);
+		return;
+	}
+#ifdef UG_DOCUGEN_ZLIB
+	TraceSpan span("gzip", filename);
+	ifstream in(filename.c_str(), ios::in | ios::binary);
+	if(!in)
+		UG_THROW("could not read '" << filename << "'.");
+	GzipSidecar gz(filename);
+	vector<char> buffer(1 << 20);
+	while(in)
+	{
+		in.read(&buffer[0], buffer.size());
+		gz.write(&buffer[0], in.gcount());
+	}
+	gz.close();
+#endif
+}
+
+void OutputFile::close()
+{
+	if(!m_bOpen) return;
+	m_bOpen = false;
+	if(m_buffer.maxBuffered > 0)
+	{
+		TraceSpan span("io", m_filename);
+		m_buffer.spill();
+		m_buffer.spillFile.close();
+		m_buffer.maxBuffered = 0;
+		string part = m_filename + ".part";
+		if(!m_buffer.spillFile)
+			UG_THROW("could not write '" << part << "'.");
+		OutputSink &sink = GetOutputSink();
+		sink.write_from_file(m_filename, part, m_buffer.bytesSpilled);
+		ForgetWrittenFile(m_filename);
+		RecordFileWritten(m_buffer.bytesSpilled);
+		if(sink.is_file_system())
+			UpdateGzipSidecarOfFile(m_filename, m_buffer.bytesSpilled);
+		m_buffer.bytesSpilled = 0;
+	}
+	else
+		WriteOutputFile(m_filename, m_buffer.data);
+	string().swap(m_buffer.data);
+}
+
+void OutputFile::stream_to_disk(size_t maxBuffered)
+{
+	if(!m_bOpen || m_buffer.maxBuffered > 0 || GetOutputSink().keeps_files_in_memory()) return;
+	string part = m_filename + ".part";
+	m_buffer.spillFile.open(part.c_str(), ios::out | ios::binary);
+	if(!m_buffer.spillFile)
+		UG_THROW("could not open '" << part << "' for writing.");
+	m_buffer.maxBuffered = maxBuffered;
+	m_buffer.bytesSpilled = 0;
+	m_buffer.spill();
+}
+
+/// filename -> content hash of the files written in this process
+static map<string, uint64_t> writtenFiles;
+static std::mutex writtenFilesMutex;
+
+void WriteOutputFile(const string &filename, const string &data)
+{
+	TraceSpan span("io", filename);
+	OutputSink &sink = GetOutputSink();
+	// an archive gets every file, so only files on disk are skipped
+	uint64_t hash = 0;
+	if(sink.is_file_system())
+	{
+		hash = ContentHash(data);
+		bool bUnchanged;
+		{
+			std::lock_guard<std::mutex> lock(writtenFilesMutex);
+			map<string, uint64_t>::iterator it = writtenFiles.find(filename);
+			bUnchanged = it != writtenFiles.end() && it->second == hash;
+		}
+		// the stats are done without the lock, which all worker threads share
+		if(bUnchanged && FileExists(filename.c_str()) && !NeedsGzipSidecar(filename, data.size()))
+			return;
+		// a failed write may leave a partial file, which must not be skipped
+		ForgetWrittenFile(filename);
+	}
+	sink.write(filename, data.data(), data.size());
+	RecordFileWritten(data.size());
+	if(sink.is_file_system())
+	{
+		UpdateGzipSidecar(filename, data.data(), data.size());
+		std::lock_guard<std::mutex> lock(writtenFilesMutex);
+		writtenFiles[filename] = hash;
+	}
+}
+
+static void ForgetWrittenFile(const string &filename)
+{
+	std::lock_guard<std::mutex> lock(writtenFilesMutex);
+	writtenFiles.erase(filename);
+}
+
+void ForgetWrittenFiles()
+{
+	std::lock_guard<std::mutex> lock(writtenFilesMutex);
+	writtenFiles.clear();
+}
+
+}	// namespace DocuGen
+}	// namespace ug
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2013-2016:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __UG__OUTPUT_FILE_H__
+#define __UG__OUTPUT_FILE_H__
+
+#include <fstream>
+#include <iostream>
+#include <streambuf>
+#include <string>
+
+namespace ug
+{
+namespace DocuGen
+{
+
+/// \addtogroup apps_ugdocu
+/// \{
+
+/// stream buffer collecting the content of an OutputFile
+class OutputFileBuffer : public std::streambuf
+{
+public:
+	OutputFileBuffer() : maxBuffered(0), bytesSpilled(0) {}
+
+	std::string data;
+	/// if > 0, data is appended to spillFile whenever it grows beyond maxBuffered
+	size_t maxBuffered;
+	std::ofstream spillFile;
+	size_t bytesSpilled;
+
+	void spill();
+
+protected:
+	virtual int_type overflow(int_type c);
+	virtual std::streamsize xsputn(const char *s, std::streamsize n);
+};
+
+/**
+ * \brief Stream for one generated file
+ * \details All generators write their files through this class instead of
+ *   std::fstream. The content is collected in memory and handed to
+ *   WriteOutputFile when the file is closed (at the latest in the destructor),
+ *   so that written files and bytes can be accounted in one place. A file
+ *   which can't be written throws a UGError and aborts the generation, the
+ *   generators don't skip it silently as they did with std::fstream.
+ */
+class OutputFile : public std::ostream
+{
+public:
+	OutputFile();
+	explicit OutputFile(const std::string &filename);
+	~OutputFile();
+
+	void open(const std::string &filename);
+	bool is_open() const { return m_bOpen; }
+	void close();
+
+	/**
+	 * \brief writes the content to disk in chunks of maxBuffered bytes
+	 * \details For files with a size growing with the registry. The file is
+	 *   written to filename.part and renamed on close, it is always rewritten.
+	 *   Has to be called after open, before anything is written. Does nothing
+	 *   if the sink keeps the files in memory anyway.
+	 */
+	void stream_to_disk(size_t maxBuffered = 1 << 20);
+
+	const std::string &filename() const { return m_filename; }
+
+private:
+	OutputFileBuffer m_buffer;
+	std::string m_filename;
+	bool m_bOpen;
+};
+
+/**
+ * \brief writes a complete file and records it for the profiling report
+ * \details The file goes to the current OutputSink. Files which were written
+ *   to the file system before in this process with the same content and
+ *   still exist are not written again. May be called from any thread.
+ *   Throws a UGError if the file can't be opened or written.
+ */
+void WriteOutputFile(const std::string &filename, const std::string &data);
+
+/// forgets which files were written, the next WriteOutputFile always writes
+void ForgetWrittenFiles();
+
+/**
+ * \brief whether a file of size bytes lacks its gzip sidecar filename.gz
+ * \details With the option gzip, WriteOutputFile and OutputFile write a
+ *   sidecar for every file of at least gzipMinSize bytes, so that a web
+ *   server can send it pre-compressed. Callers skipping unchanged files
+ *   use this to write the file nevertheless if the sidecar is missing.
+ */
+bool NeedsGzipSidecar(const std::string &filename, size_t size);
+
+/// whether filename exists on the file system and output files are written there,
+/// for callers skipping unchanged files (an archive sink needs all files)
+bool OutputFileExists(const std::string &filename);
+
+/// size of filename.gz, 0 if there is none
+size_t CompressedFileSize(const std::string &filename);
+
+// end group apps_ugdocu
+/// \}
+
+}	// namespace DocuGen
+}	// namespace ug
+
+#endif /* __UG__OUTPUT_FILE_H__ */
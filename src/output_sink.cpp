@@ -0,0 +1,349 @@
+/*
+ * Copyright (c) 2013-2016:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common/log.h"
+#include "common/error.h"
+
+#include "output_sink.h"
+#include "ugdocu_parallel.h"
+
+using namespace std;
+
+namespace ug
+{
+namespace DocuGen
+{
+
+/// writes every file to the file system
+class FileSystemSink : public OutputSink
+{
+public:
+	virtual void write(const string &filename, const char *data, size_t size)
+	{
+		ofstream f(filename.c_str(), ios::out | ios::binary);
+		if(!f)
+			UG_THROW("could not open '" << filename << "' for writing.");
+		f.write(data, size);
+		if(!f)
+			UG_THROW("could not write '" << filename << "'.");
+	}
+
+	virtual void write_from_file(const string &filename, const string &tmpFilename, size_t size)
+	{
+		// rename doesn't replace existing files everywhere
+		remove(filename.c_str());
+		if(rename(tmpFilename.c_str(), filename.c_str()) != 0)
+			UG_THROW("could not rename '" << tmpFilename << "' to '" << filename << "'.");
+	}
+
+	virtual bool is_file_system() const { return true; }
+};
+
+/// common part of the tar and pack sinks: one output stream, entries are written one after another
+class ArchiveSink : public OutputSink
+{
+public:
+	ArchiveSink(const string &filename, const string &root)
+		: m_filename(filename), m_root(root), m_offset(0), m_bStdout(filename == "-")
+	{
+		if(m_bStdout)
+			m_out = &cout;
+		else
+		{
+			m_file.open(filename.c_str(), ios::out | ios::binary);
+			if(!m_file)
+				UG_THROW("could not open '" << filename << "' for writing.");
+			m_out = &m_file;
+		}
+	}
+
+	virtual void write(const string &filename, const char *data, size_t size)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		begin_entry(archive_name(filename), size);
+		put(data, size);
+		end_entry(size);
+	}
+
+	virtual void write_from_file(const string &filename, const string &tmpFilename, size_t size)
+	{
+		{
+			ifstream in(tmpFilename.c_str(), ios::in | ios::binary);
+			if(!in)
+				UG_THROW("could not read '" << tmpFilename << "'.");
+			vector<char> buffer(1 << 20);
+			std::lock_guard<std::mutex> lock(m_mutex);
+			begin_entry(archive_name(filename), size);
+			size_t remaining = size;
+			while(remaining > 0 && in)
+			{
+				in.read(&buffer[0], min(remaining, buffer.size()));
+				put(&buffer[0], in.gcount());
+				remaining -= in.gcount();
+			}
+			if(remaining > 0)
+				UG_THROW("could not read '" << tmpFilename << "'.");
+			end_entry(size);
+		}
+		remove(tmpFilename.c_str());
+	}
+
+	virtual void close()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		finish();
+		m_out->flush();
+		if(!*m_out)
+			UG_THROW("could not write '" << m_filename << "'.");
+		if(!m_bStdout)
+			m_file.close();
+	}
+
+	virtual bool writes_to_stdout() const { return m_bStdout; }
+
+protected:
+	virtual void begin_entry(const string &name, size_t size) = 0;
+	virtual void end_entry(size_t size) = 0;
+	/// writes what follows the last entry
+	virtual void finish() = 0;
+
+	void put(const char *data, size_t size)
+	{
+		m_out->write(data, size);
+		m_offset += size;
+	}
+
+	/// filename relative to the root, without "./" and a leading '/'
+	string archive_name(const string &filename) const
+	{
+		string name = filename;
+		if(!m_root.empty() && name.compare(0, m_root.size(), m_root) == 0)
+			name = name.substr(m_root.size());
+		while(name.compare(0, 2, "./") == 0)
+			name = name.substr(2);
+		while(!name.empty() && name[0] == '/')
+			name = name.substr(1);
+		return name;
+	}
+
+	string m_filename;
+	string m_root;
+	ofstream m_file;
+	ostream *m_out;
+	size_t m_offset;
+	bool m_bStdout;
+	std::mutex m_mutex;
+};
+
+/// POSIX ustar stream with GNU long names
+class TarSink : public ArchiveSink
+{
+public:
+	TarSink(const string &filename, const string &root)
+		: ArchiveSink(filename, root), m_mtime(time(0)) {}
+
+protected:
+	virtual void begin_entry(const string &name, size_t size)
+	{
+		string shortName = name, prefix;
+		if(name.size() > 100)
+		{
+			// ustar splits long names at a '/' into prefix (155) and name (100)
+			size_t slash = name.find('/', name.size() > 101 ? name.size()-101 : 0);
+			if(slash != string::npos && slash <= 155 && name.size()-slash-1 <= 100 && slash+1 < name.size())
+			{
+				prefix = name.substr(0, slash);
+				shortName = name.substr(slash+1);
+			}
+			else
+			{
+				// GNU tar long name entry, the name follows as content
+				write_header("././@LongLink", "", name.size()+1, 'L');
+				put(name.c_str(), name.size()+1);
+				pad(name.size()+1);
+				shortName = name.substr(0, 100);
+			}
+		}
+		write_header(shortName, prefix, size, '0');
+	}
+
+	virtual void end_entry(size_t size)
+	{
+		pad(size);
+	}
+
+	virtual void finish()
+	{
+		char zero[1024];
+		memset(zero, 0, sizeof(zero));
+		put(zero, sizeof(zero));
+	}
+
+private:
+	static void octal(char *field, size_t len, unsigned long long value)
+	{
+		stringstream ss;
+		ss << oct << setw(len-1) << setfill('0') << value;
+		memcpy(field, ss.str().c_str(), len-1);
+		field[len-1] = 0;
+	}
+
+	void write_header(const string &name, const string &prefix, size_t size, char type)
+	{
+		char header[512];
+		memset(header, 0, sizeof(header));
+		memcpy(header, name.c_str(), min(name.size(), (size_t) 100));
+		octal(header+100, 8, 0644);
+		octal(header+108, 8, 0);
+		octal(header+116, 8, 0);
+		octal(header+124, 12, size);
+		octal(header+136, 12, m_mtime);
+		header[156] = type;
+		memcpy(header+257, "ustar", 6);
+		memcpy(header+263, "00", 2);
+		memcpy(header+345, prefix.c_str(), min(prefix.size(), (size_t) 155));
+
+		// the checksum is computed with spaces in its own field
+		memset(header+148, ' ', 8);
+		unsigned int sum = 0;
+		for(size_t i=0; i<sizeof(header); i++)
+			sum += (unsigned char) header[i];
+		octal(header+148, 7, sum);
+		header[155] = ' ';
+		put(header, sizeof(header));
+	}
+
+	/// fills the last block of an entry with size bytes
+	void pad(size_t size)
+	{
+		static const char zero[512] = {0};
+		if(size % 512 != 0)
+			put(zero, 512 - size % 512);
+	}
+
+	time_t m_mtime;
+};
+
+/// files back to back with an index at the end
+class PackSink : public ArchiveSink
+{
+public:
+	PackSink(const string &filename, const string &root)
+		: ArchiveSink(filename, root)
+	{
+		const char magic[] = "UGDOCUPACK 1\n";
+		put(magic, strlen(magic));
+	}
+
+protected:
+	virtual void begin_entry(const string &name, size_t size)
+	{
+		m_index << m_offset << "\t" << size << "\t" << name << "\n";
+	}
+
+	virtual void end_entry(size_t size) {}
+
+	virtual void finish()
+	{
+		size_t indexOffset = m_offset;
+		string index = m_index.str();
+		put(index.c_str(), index.size());
+		stringstream trailer;
+		trailer << "UGDOCUINDEX " << setw(19) << setfill('0') << indexOffset << "\n";
+		put(trailer.str().c_str(), trailer.str().size());
+	}
+
+private:
+	stringstream m_index;
+};
+
+static FileSystemSink fileSystemSink;
+static unique_ptr<OutputSink> archiveSink;
+static OutputSink *currentSink = &fileSystemSink;
+
+void OpenOutputSink(const string &type, const string &filename, const string &root)
+{
+	CloseOutputSink();
+	if(type.empty() || type == "files")
+		return;
+	if(type != "tar" && type != "pack")
+	{
+		UG_WARNING("DocuGen: unknown sink '" << type << "', writing files.\n");
+		return;
+	}
+	if(GetDocuGenNumRanks() > 1)
+	{
+		UG_WARNING("DocuGen: sink '" << type << "' needs a single process, writing files.\n");
+		return;
+	}
+	if(type == "tar")
+		archiveSink.reset(new TarSink(filename, root));
+	else
+		archiveSink.reset(new PackSink(filename, root));
+	currentSink = archiveSink.get();
+}
+
+void CloseOutputSink()
+{
+	if(archiveSink.get() == NULL) return;
+	// returns to the file system even if finishing the archive fails
+	currentSink = &fileSystemSink;
+	unique_ptr<OutputSink> sink(archiveSink.release());
+	sink->close();
+}
+
+OutputSink &GetOutputSink()
+{
+	return *currentSink;
+}
+
+void SetOutputSink(OutputSink *sink)
+{
+	CloseOutputSink();
+	currentSink = sink != NULL ? sink : &fileSystemSink;
+}
+
+}	// namespace DocuGen
+}	// namespace ug
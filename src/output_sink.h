@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2013-2016:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __UG__OUTPUT_SINK_H__
+#define __UG__OUTPUT_SINK_H__
+
+#include <string>
+
+namespace ug
+{
+namespace DocuGen
+{
+
+/// \addtogroup apps_ugdocu
+/// \{
+
+/**
+ * \brief Destination of the files written by WriteOutputFile and OutputFile
+ * \details The default sink writes every file to the file system. The
+ *   archive sinks (see OpenOutputSink) collect all files in one tar or pack
+ *   stream instead, which is a single sequential write. Sinks may be called
+ *   from any thread.
+ */
+class OutputSink
+{
+public:
+	virtual ~OutputSink() {}
+
+	/// writes the complete file filename
+	virtual void write(const std::string &filename, const char *data, size_t size) = 0;
+
+	/// writes the content of tmpFilename (size bytes) as filename and removes tmpFilename
+	virtual void write_from_file(const std::string &filename, const std::string &tmpFilename, size_t size) = 0;
+
+	/// finishes the output, no files can be written afterwards
+	virtual void close() {}
+
+	/// whether files are written to the file system, so existing files can be
+	/// compared and gzip sidecars written next to them
+	virtual bool is_file_system() const { return false; }
+
+	/// whether the output goes to stdout, which then can't be used for messages
+	virtual bool writes_to_stdout() const { return false; }
+
+	/// whether the files end up in memory, so OutputFile::stream_to_disk
+	/// would not save any
+	virtual bool keeps_files_in_memory() const { return false; }
+};
+
+/**
+ * \brief Directs the output files into an archive
+ * \details type is
+ *   - "files": the file system (default)
+ *   - "tar": a POSIX ustar stream, names longer than the ustar fields get a
+ *     GNU long name entry
+ *   - "pack": the files back to back after the line "UGDOCUPACK 1", followed
+ *     by an index of lines "offset <TAB> size <TAB> name" and the 32 byte
+ *     trailer "UGDOCUINDEX " + 19 digit offset of the index + "\n". A reader
+ *     seeks to the trailer, reads the index and then every file with one seek.
+ *
+ *   filename "-" is stdout. The names in the archive are relative to root,
+ *   files outside of root keep their path without the leading '/'. With
+ *   several processes, each would need its own archive, so the files are
+ *   written to the file system.
+ */
+void OpenOutputSink(const std::string &type, const std::string &filename, const std::string &root);
+
+/// finishes an archive opened by OpenOutputSink and returns to the file system
+void CloseOutputSink();
+
+/// the current sink
+OutputSink &GetOutputSink();
+
+/// directs the output into sink (not owned, e.g. the page cache of the docu
+/// server) until it is called with NULL, which returns to the file system
+void SetOutputSink(OutputSink *sink);
+
+// end group apps_ugdocu
+/// \}
+
+}	// namespace DocuGen
+}	// namespace ug
+
+#endif /* __UG__OUTPUT_SINK_H__ */
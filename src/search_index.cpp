@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) 2013-2016:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "common/log.h"
+#include "common/error.h"
+#include "registry/class_helper.h"
+
+#include "ugdocu_misc.h"
+#include "ugdocu_filter.h"
+#include "html_generation.h"
+#include "output_file.h"
+#include "search_index.h"
+
+// to refresh this file, use xxd -i ugdocu_search.js > ugdocu_search.js.h
+#include "ugdocu_search.js.h"
+
+using namespace std;
+
+namespace ug
+{
+namespace DocuGen
+{
+
+using namespace bridge;
+
+/// one entry of search_index.js
+class SearchEntry
+{
+public:
+	SearchEntry(const string &name_, char kind_, size_t page_, const string &context_)
+		: name(name_), key(name_), kind(kind_), page(page_), context(context_)
+	{
+		transform(key.begin(), key.end(), key.begin(), ::tolower);
+	}
+
+	bool operator < (const SearchEntry &other) const
+	{
+		if(key != other.key) return key < other.key;
+		if(name != other.name) return name < other.name;
+		if(kind != other.kind) return kind < other.kind;
+		return context < other.context;
+	}
+
+	bool operator == (const SearchEntry &other) const
+	{
+		return name == other.name && kind == other.kind && page == other.page && context == other.context;
+	}
+
+	string name;
+	string key;		///< lower case name, the index is sorted by it
+	char kind;		///< 'c'lass, class 'g'roup, registry g'r'oup, 'm'ember function, 'f'unction
+	size_t page;
+	string context;	///< class of a member function, group of everything else
+	string text;	///< tooltips and help texts for the full-text index
+};
+
+/// tooltip and help of a registered function, constructor or class
+template<typename T>
+static string DocumentationText(const T &t)
+{
+	string text = t.tooltip();
+	if(t.help().size() > 0 && t.help().compare("No help") != 0)
+		text += " " + t.help();
+	return text;
+}
+
+/// not indexed, written to search_text_index.js so that ugdocu_search.js skips them as well
+static const char *stopWords[] = {"an", "and", "are", "as", "at", "be", "by", "for", "from", "if",
+	"in", "is", "it", "of", "on", "or", "the", "this", "to", "with", NULL};
+
+static bool IsStopWord(const string &word)
+{
+	for(size_t i=0; stopWords[i] != NULL; i++)
+		if(word == stopWords[i]) return true;
+	return false;
+}
+
+/// lower case alphanumeric words with at least two characters, same as ugdocu_search.js
+static void TokenizeText(const string &text, set<string> &terms)
+{
+	string word;
+	for(size_t i=0; i<=text.size(); i++)
+	{
+		unsigned char c = i < text.size() ? text[i] : ' ';
+		if(c < 128 && isalnum(c))
+			word += (char) tolower(c);
+		else
+		{
+			if(word.size() >= 2 && !IsStopWord(word))
+				terms.insert(word);
+			word.clear();
+		}
+	}
+}
+
+/// numbers in base 36
+static void WriteBase36(ostream &out, size_t n)
+{
+	char digits[16];
+	size_t len = 0;
+	do
+	{
+		digits[len++] = "0123456789abcdefghijklmnopqrstuvwxyz"[n % 36];
+		n /= 36;
+	} while(n > 0);
+	while(len > 0)
+		out << digits[--len];
+}
+
+/**
+ * writes search_text_index.js with the stop words, the terms of the tooltips
+ * and help texts of the entries, sorted, and for every term the posting list of entry ids
+ * (positions in search_index.js). The ids are delta encoded in base 36.
+ */
+static size_t WriteTextIndex(const string &filename, const vector<SearchEntry> &entries)
+{
+	map<string, vector<size_t> > postings;
+	for(size_t i=0; i<entries.size(); i++)
+	{
+		if(entries[i].text.empty()) continue;
+		set<string> terms;
+		TokenizeText(entries[i].text, terms);
+		for(set<string>::iterator it = terms.begin(); it != terms.end(); ++it)
+			postings[*it].push_back(i);
+	}
+
+	OutputFile f(filename);
+	f << "// generated by ugdocu, postings are ids of ugdocuSearchIndex, delta encoded in base 36\n";
+	f << "var ugdocuTextStopWords = [";
+	for(size_t i=0; stopWords[i] != NULL; i++)
+		f << (i == 0 ? "" : ",") << "\"" << stopWords[i] << "\"";
+	f << "];\n";
+	f << "var ugdocuTextTerms = [";
+	for(map<string, vector<size_t> >::iterator it = postings.begin(); it != postings.end(); ++it)
+		f << (it == postings.begin() ? "\n" : ",\n") << "\"" << it->first << "\"";
+	f << "];\n";
+	f << "var ugdocuTextPostings = [";
+	for(map<string, vector<size_t> >::iterator it = postings.begin(); it != postings.end(); ++it)
+	{
+		f << (it == postings.begin() ? "\n\"" : ",\n\"");
+		size_t last = 0;
+		for(size_t j=0; j<it->second.size(); j++)
+		{
+			if(j > 0) f << ",";
+			WriteBase36(f, it->second[j] - last);
+			last = it->second[j];
+		}
+		f << "\"";
+	}
+	f << "];\n";
+	return postings.size();
+}
+
+/// pages referenced by the search entries
+class SearchPages
+{
+public:
+	size_t get(const string &page)
+	{
+		map<string, size_t>::iterator it = m_index.find(page);
+		if(it != m_index.end()) return it->second;
+		m_index[page] = pages.size();
+		pages.push_back(page);
+		return pages.size()-1;
+	}
+
+	vector<string> pages;
+
+private:
+	map<string, size_t> m_index;
+};
+
+static void AddMethodEntries(vector<SearchEntry> &entries, const ExportedMethodGroup &grp, size_t page, const string &className)
+{
+	// overloads share the anchor and the entry
+	if(grp.num_overloads() == 0) return;
+	entries.push_back(SearchEntry(grp.get_overload(0)->name(), 'm', page, className));
+	for(size_t i=0; i<grp.num_overloads(); i++)
+		entries.back().text += " " + DocumentationText(*grp.get_overload(i));
+}
+
+void WriteSearchIndex(const char *dir)
+{
+	try{
+	UG_LOG("WriteSearchIndex... ");
+	Registry &reg = GetUGRegistry();
+	const DocuGenFilter &filter = GetDocuGenFilter();
+	SearchPages pages;
+	vector<SearchEntry> entries;
+
+	for(size_t i=0; i<reg.num_classes(); i++)
+	{
+		const IExportedClass &c = reg.get_class(i);
+		if(!filter.class_selected(&c)) continue;
+		size_t page = pages.get(string(c.name()) + ".html");
+		entries.push_back(SearchEntry(c.name(), 'c', page, c.group()));
+		entries.back().text = DocumentationText(c);
+		for(size_t j=0; j<c.num_constructors(); j++)
+			entries.back().text += " " + DocumentationText(c.get_constructor(j));
+		for(size_t j=0; j<c.num_methods(); j++)
+			AddMethodEntries(entries, c.get_method_group(j), page, c.name());
+		for(size_t j=0; j<c.num_const_methods(); j++)
+			AddMethodEntries(entries, c.get_const_method_group(j), page, c.name());
+	}
+
+	for(size_t i=0; i<reg.num_class_groups(); i++)
+	{
+		const ClassGroupDesc *g = reg.get_class_group(i);
+		if(!filter.class_group_selected(g) || g->get_default_class() == NULL) continue;
+		size_t page = pages.get(string(g->get_default_class()->name()) + ".html");
+		entries.push_back(SearchEntry(g->name(), 'g', page, g->get_default_class()->group()));
+	}
+
+	map<string, bool> groups;
+	for(size_t i=0; i<reg.num_functions(); i++)
+	{
+		ExportedFunctionGroup &fg = reg.get_function_group(i);
+		for(size_t j=0; j<fg.num_overloads(); j++)
+		{
+			const ExportedFunction *f = fg.get_overload(j);
+			if(!filter.function_selected(f)) continue;
+			entries.push_back(SearchEntry(f->name(), 'f', pages.get(GetFunctionIndexPage(f->name())), f->group()));
+			entries.back().text = DocumentationText(*f);
+			groups[f->group()] = true;
+		}
+	}
+	for(size_t i=0; i<reg.num_classes(); i++)
+		if(filter.class_selected(&reg.get_class(i)))
+			groups[reg.get_class(i).group()] = true;
+	for(map<string, bool>::iterator it = groups.begin(); it != groups.end(); ++it)
+		if(!it->first.empty() && filter.group_selected(it->first))
+			entries.push_back(SearchEntry(it->first, 'r', pages.get(GetFilenameForGroup(it->first)), ""));
+
+	// merge equal entries (e.g. overloaded functions) and their texts
+	sort(entries.begin(), entries.end());
+	size_t numUnique = 0;
+	for(size_t i=0; i<entries.size(); i++)
+	{
+		if(numUnique > 0 && entries[numUnique-1] == entries[i])
+			entries[numUnique-1].text += " " + entries[i].text;
+		else if(numUnique++ != i)
+			swap(entries[numUnique-1], entries[i]);
+	}
+	entries.resize(numUnique, SearchEntry("", ' ', 0, ""));
+
+	size_t numTerms = WriteTextIndex(string(dir) + "search_text_index.js", entries);
+
+	{
+		OutputFile f(string(dir) + "search_index.js");
+		f << "// generated by ugdocu, entries are [name, kind, page, context] sorted by lower case name\n";
+		f << "var ugdocuSearchPages = [";
+		for(size_t i=0; i<pages.pages.size(); i++)
+			f << (i ? ",\n" : "\n") << "\"" << JSONStringEscape(pages.pages[i]) << "\"";
+		f << "];\n";
+		f << "var ugdocuSearchIndex = [";
+		for(size_t i=0; i<entries.size(); i++)
+		{
+			const SearchEntry &e = entries[i];
+			f << (i ? ",\n" : "\n") << "[\"" << JSONStringEscape(e.name) << "\",\"" << e.kind << "\"," << e.page
+				<< ",\"" << JSONStringEscape(e.context) << "\"]";
+		}
+		f << "];\n";
+	}
+
+	WriteAsset(dir, "ugdocu_search.js", ugdocu_search_js, ugdocu_search_js_len);
+
+	{
+		OutputFile f(string(dir) + "search.html");
+		WriteHeader(f, "Search");
+		f << "<h1>Search</h1>\n";
+		f << "<p><input type=\"text\" id=\"ugdocuSearchInput\" size=\"60\" autocomplete=\"off\""
+			" placeholder=\"class, group or function name\"></p>\n";
+		f << "<p><input type=\"text\" id=\"ugdocuTextInput\" size=\"60\" autocomplete=\"off\""
+			" placeholder=\"words in tooltips and help texts\"></p>\n";
+		f << "<div id=\"ugdocuSearchResults\"></div>\n";
+		f << "<script type=\"text/javascript\" src=\"search_index.js\"></script>\n";
+		f << "<script type=\"text/javascript\" src=\"search_text_index.js\"></script>\n";
+		f << "<script type=\"text/javascript\" src=\"" << AssetFilename("ugdocu_search.js", ugdocu_search_js, ugdocu_search_js_len) << "\"></script>\n";
+		WriteFooter(f);
+	}
+
+	UG_LOG(entries.size() << " entries on " << pages.pages.size() << " pages, " << numTerms << " terms." << endl);
+	}UG_CATCH_THROW_FUNC();
+}
+
+}	// namespace DocuGen
+}	// namespace ug
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2013-2016:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __UG__SEARCH_INDEX_H__
+#define __UG__SEARCH_INDEX_H__
+
+#include <string>
+
+namespace ug
+{
+namespace DocuGen
+{
+
+/// \addtogroup apps_ugdocu
+/// \{
+
+/**
+ * \brief Writes search.html with the search index for the HTML docu
+ * \details search_index.js holds a table of all classes, class groups,
+ *   registry groups, member functions and global functions, sorted by
+ *   lower case name. Every entry references its page (and the function
+ *   anchor on it) by an index into a page table, so the index stays compact.
+ *   ugdocu_search.js looks up prefixes with a binary search while typing.
+ *
+ *   search_text_index.js is an inverted index of the words in tooltips and
+ *   help texts, mapping every term to the entries using it. A text query
+ *   returns the entries containing all query words (as word prefixes).
+ *
+ *   Only entries selected by the DocuGenFilter are indexed.
+ */
+void WriteSearchIndex(const char *dir);
+
+// end group apps_ugdocu
+/// \}
+
+}	// namespace DocuGen
+}	// namespace ug
+
+#endif /* __UG__SEARCH_INDEX_H__ */
@@ -0,0 +1,319 @@
+/*
+ * Copyright (c) 2013-2016:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#include <string>
+#include <vector>
+
+#include "common/log.h"
+#include "common/error.h"
+#include "registry/class_helper.h"
+
+#include "ugdocu_misc.h"
+#include "ugdocu_filter.h"
+#include "docugen_session.h"
+#include "output_file.h"
+#include "html_generation.h"
+#include "single_page.h"
+
+// xxd -i ugdocu_viewer.html > ugdocu_viewer.html.h
+#include "ugdocu_viewer.html.h"
+
+using namespace std;
+
+namespace ug
+{
+namespace DocuGen
+{
+
+using namespace bridge;
+
+static void WriteJSONString(ostream &out, const string &str)
+{
+	out << "\"" << JSONStringEscape(str) << "\"";
+}
+
+/// "tooltip" and "help" members, the ones not set are left out
+template<typename T>
+static void WriteDocumentationJSON(ostream &out, const T &t)
+{
+	if(t.tooltip().size() > 0)
+	{
+		out << ",\"tooltip\":";
+		WriteJSONString(out, t.tooltip());
+	}
+	if(t.help().size() > 0 && t.help().compare("No help") != 0)
+	{
+		out << ",\"help\":";
+		WriteJSONString(out, t.help());
+	}
+}
+
+/// in parameters as "type name" strings, like WriteParametersIn
+template<typename T>
+static void WriteParametersInJSON(ostream &out, const T &thefunc)
+{
+	out << "[";
+	for(size_t i=0; i < (size_t)thefunc.params_in().size(); ++i)
+	{
+		if(i>0) out << ",";
+		string param = ParameterToString(thefunc.params_in(), i);
+		if(i<thefunc.num_parameter() && thefunc.parameter_name(i).size() > 0)
+			param += " " + thefunc.parameter_name(i);
+		WriteJSONString(out, param);
+	}
+	out << "]";
+}
+
+/// group is only given for global functions
+static void WriteFunctionJSON(ostream &out, const ExportedFunctionBase &thefunc, const string *group = NULL)
+{
+	out << "{\"name\":";
+	WriteJSONString(out, thefunc.name());
+	out << ",\"in\":";
+	WriteParametersInJSON(out, thefunc);
+	out << ",\"out\":[";
+	for(size_t i=0; i < (size_t)thefunc.params_out().size(); ++i)
+	{
+		if(i>0) out << ",";
+		WriteJSONString(out, ParameterToString(thefunc.params_out(), i));
+	}
+	out << "]";
+	if(thefunc.return_name().size() > 0)
+	{
+		out << ",\"returns\":";
+		WriteJSONString(out, thefunc.return_name());
+	}
+	if(group != NULL)
+	{
+		out << ",\"group\":";
+		WriteJSONString(out, *group);
+	}
+	WriteDocumentationJSON(out, thefunc);
+	out << "}";
+}
+
+static void WriteMethodsJSON(ostream &out, const IExportedClass &c, bool bConst)
+{
+	out << "[";
+	bool bFirst = true;
+	size_t numGroups = bConst ? c.num_const_methods() : c.num_methods();
+	for(size_t i=0; i<numGroups; i++)
+	{
+		const ExportedMethodGroup &g = bConst ? c.get_const_method_group(i) : c.get_method_group(i);
+		for(size_t j=0; j<g.num_overloads(); j++)
+		{
+			out << (bFirst ? "\n" : ",\n");
+			bFirst = false;
+			WriteFunctionJSON(out, *g.get_overload(j));
+		}
+	}
+	out << "]";
+}
+
+/// {"functions":[names], "methods":[[class, method], ...]}
+static void WriteUsageJSON(ostream &out, const vector<const ExportedFunction*> &functions,
+		const vector<pair<const ExportedMethod*, const IExportedClass*> > &methods)
+{
+	const DocuGenFilter &filter = GetDocuGenFilter();
+	out << "{\"functions\":[";
+	bool bFirst = true;
+	for(size_t i=0; i<functions.size(); i++)
+	{
+		if(!filter.function_selected(functions[i])) continue;
+		if(!bFirst) out << ",";
+		bFirst = false;
+		WriteJSONString(out, functions[i]->name());
+	}
+	out << "],\"methods\":[";
+	bFirst = true;
+	for(size_t i=0; i<methods.size(); i++)
+	{
+		if(!filter.class_selected(methods[i].second)) continue;
+		if(!bFirst) out << ",";
+		bFirst = false;
+		out << "[";
+		WriteJSONString(out, methods[i].second->name());
+		out << ",";
+		WriteJSONString(out, methods[i].first->name());
+		out << "]";
+	}
+	out << "]}";
+}
+
+static void WriteClassJSON(ostream &out, const IExportedClass &c)
+{
+	out << "{\"name\":";
+	WriteJSONString(out, c.name());
+	out << ",\"group\":";
+	WriteJSONString(out, c.group());
+	WriteDocumentationJSON(out, c);
+	out << ",\"instantiable\":" << (c.is_instantiable() ? "true" : "false");
+
+	// class_names() starts with the class itself
+	out << ",\"bases\":[";
+	const vector<const char*> *names = c.class_names();
+	for(size_t i=1; names != NULL && i<names->size(); i++)
+	{
+		if(i>1) out << ",";
+		WriteJSONString(out, names->at(i));
+	}
+	out << "]";
+
+	out << ",\"constructors\":[";
+	for(size_t i=0; i<c.num_constructors(); i++)
+	{
+		const ExportedConstructor &constr = c.get_constructor(i);
+		out << (i ? "," : "") << "{\"in\":";
+		WriteParametersInJSON(out, constr);
+		WriteDocumentationJSON(out, constr);
+		out << "}";
+	}
+	out << "],\n\"methods\":";
+	WriteMethodsJSON(out, c, false);
+	out << ",\n\"constMethods\":";
+	WriteMethodsJSON(out, c, true);
+
+	const ClassUsage *usage = GetDocuGenSession().class_usage(c.name());
+	if(usage != NULL)
+	{
+		out << ",\n\"usedIn\":";
+		WriteUsageJSON(out, usage->functionsIn, usage->methodsIn);
+		out << ",\n\"returnedBy\":";
+		WriteUsageJSON(out, usage->functionsOut, usage->methodsOut);
+	}
+	out << "}";
+}
+
+static void WriteClassGroupJSON(ostream &out, const ClassGroupDesc &g)
+{
+	out << "{\"name\":";
+	WriteJSONString(out, g.name());
+	if(g.get_default_class() != NULL)
+	{
+		out << ",\"group\":";
+		WriteJSONString(out, g.get_default_class()->group());
+		out << ",\"default\":";
+		WriteJSONString(out, g.get_default_class()->name());
+	}
+	out << ",\"classes\":[";
+	for(size_t i=0; i<g.num_classes(); i++)
+	{
+		out << (i ? "," : "") << "[";
+		WriteJSONString(out, g.get_class_tag(i));
+		out << ",";
+		WriteJSONString(out, g.get_class(i)->name());
+		out << "]";
+	}
+	out << "]}";
+}
+
+/// [name, isGroup, [subclasses]]
+static void WriteHierarchyJSON(ostream &out, const ClassHierarchy &c)
+{
+	out << "[";
+	WriteJSONString(out, c.name);
+	out << "," << (c.bGroup ? "true" : "false") << ",[";
+	for(size_t i=0; i<c.subclasses.size(); i++)
+	{
+		if(i>0) out << ",";
+		WriteHierarchyJSON(out, c.subclasses[i]);
+	}
+	out << "]]";
+}
+
+void WriteSinglePageDocu(const char *dir, vector<UGDocuClassDescription> &classesAndGroups,
+		ClassHierarchy &hierarchy)
+{
+	try{
+	UG_LOG("WriteSinglePageDocu... ");
+	Registry &reg = GetUGRegistry();
+	const DocuGenFilter &filter = GetDocuGenFilter();
+
+	size_t numClasses = 0, numClassGroups = 0, numFunctions = 0;
+	{
+		OutputFile f(string(dir) + "ugdocu_data.json");
+		// the size grows with the registry
+		f.stream_to_disk();
+
+		f << "{\"version\":1,\n\"classes\":[";
+		for(size_t i=0; i<reg.num_classes(); i++)
+		{
+			const IExportedClass &c = reg.get_class(i);
+			if(!filter.class_selected(&c)) continue;
+			f << (numClasses++ ? ",\n" : "\n");
+			WriteClassJSON(f, c);
+		}
+
+		f << "],\n\"classGroups\":[";
+		for(size_t i=0; i<classesAndGroups.size(); i++)
+		{
+			const UGDocuClassDescription &d = classesAndGroups[i];
+			if(d.mp_group == NULL || !filter.class_group_selected(d.mp_group)) continue;
+			f << (numClassGroups++ ? ",\n" : "\n");
+			WriteClassGroupJSON(f, *d.mp_group);
+		}
+
+		f << "],\n\"functions\":[";
+		for(size_t i=0; i<reg.num_functions(); i++)
+		{
+			ExportedFunctionGroup &fg = reg.get_function_group(i);
+			for(size_t j=0; j<fg.num_overloads(); j++)
+			{
+				const ExportedFunction &func = *fg.get_overload(j);
+				if(!filter.function_selected(&func)) continue;
+				f << (numFunctions++ ? ",\n" : "\n");
+				WriteFunctionJSON(f, func, &func.group());
+			}
+		}
+
+		f << "],\n\"hierarchy\":";
+		WriteHierarchyJSON(f, hierarchy);
+		f << "}\n";
+	}
+
+	{
+		// the viewer references ugdocu.css under its hashed name
+		string viewer((const char *)ugdocu_viewer_html, ugdocu_viewer_html_len);
+		string css = "href=\"ugdocu.css\"";
+		size_t pos = viewer.find(css);
+		if(pos != string::npos)
+			viewer.replace(pos, css.size(), "href=\"" + UGDocuCSSFilename() + "\"");
+		OutputFile f(string(dir) + "ugdocu.html");
+		f << viewer;
+	}
+
+	UG_LOG(numClasses << " classes, " << numClassGroups << " class groups, " << numFunctions << " functions." << endl);
+	}UG_CATCH_THROW_FUNC();
+}
+
+}	// namespace DocuGen
+}	// namespace ug
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2013-2016:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+// Compiled once per chunk with UG_DOCUGEN_SYNTHETIC_CHUNK set to the chunk
+// index, CMakeLists.txt generates one source including this file per chunk.
+
+#include <string>
+
+#include "common/log.h"
+#include "common/error.h"
+#include "registry/registry.h"
+
+#include "synthetic_classes.h"
+
+using namespace std;
+
+namespace ug
+{
+namespace DocuGen
+{
+
+// inheritance chains never cross chunks
+#if UG_DOCUGEN_SYNTHETIC_CHUNK_SIZE % 8 != 0
+#error "UG_DOCUGEN_SYNTHETIC_CHUNK_SIZE has to be a multiple of the chain length 8"
+#endif
+
+template<int N> class SyntheticClass;
+
+/// class N derives from N-1, except for the first class of every chain
+template<int N, bool bChainStart = (N % SYNTHETIC_CHAIN_LENGTH == 0)>
+struct SyntheticBase
+{
+	typedef SyntheticClass<N-1> type;
+};
+
+template<int N>
+struct SyntheticBase<N, true>
+{
+	typedef SyntheticRoot type;
+};
+
+template<int N>
+class SyntheticClass : public SyntheticBase<N>::type
+{
+	public:
+		SyntheticClass() {}
+		SyntheticClass(int, number) {}
+
+		void method0() {}
+		void method1(int) {}
+		number method2(number, size_t) { return 0; }
+		std::string method3(const char *) { return ""; }
+		bool method4(SmartPtr<SyntheticRoot>, bool) { return true; }
+		number const_method() const { return N; }
+};
+
+template<typename T>
+static void AddSyntheticMethods(bridge::ExportedClass<T> &cls, size_t classIndex, const SyntheticRegistryConfig &cfg)
+{
+	for(size_t m=0; m<cfg.methodsPerClass; m++)
+	{
+		stringstream ss;
+		ss << "method" << m;
+		string name = ss.str();
+		string tooltip = SyntheticText(classIndex * 131 + m, 4);
+		string help = SyntheticText(classIndex * 257 + m, 12);
+
+		if(m % 4 == 3)
+		{
+			cls.add_method(name, &T::const_method, "value", "", tooltip, help);
+			continue;
+		}
+
+		for(size_t o=0; o<cfg.overloadsPerMethod; o++)
+		{
+			switch(o)
+			{
+				case 0: cls.add_method(name, &T::method0, "", "", tooltip, help); break;
+				case 1: cls.add_method(name, &T::method1, "", "count", tooltip, help); break;
+				case 2: cls.add_method(name, &T::method2, "result", "factor # size", tooltip, help); break;
+				case 3: cls.add_method(name, &T::method3, "text", "filename", tooltip, help); break;
+				case 4: cls.add_method(name, &T::method4, "success", "object # flag", tooltip, help); break;
+			}
+		}
+	}
+}
+
+template<int N>
+static void RegisterSyntheticClass(bridge::Registry &reg, const SyntheticRegistryConfig &cfg)
+{
+	typedef SyntheticClass<N> T;
+	typedef typename SyntheticBase<N>::type TBase;
+
+	string name, groupName, tag;
+	SyntheticClassName(N, cfg, name, groupName, tag);
+	string grp = SyntheticRegistryGroup(N, cfg);
+	string tooltip = SyntheticText(N, 6);
+
+	// class N is the (N % chain length)+1-th class of its chain
+	bool bDerived = (size_t) (N % SYNTHETIC_CHAIN_LENGTH) < cfg.inheritanceDepth;
+	bridge::ExportedClass<T> &cls = bDerived
+			? reg.add_class_<T, TBase>(name, grp, tooltip)
+			: reg.add_class_<T>(name, grp, tooltip);
+
+	cls.template add_constructor<void (*)()>()
+		.template add_constructor<void (*)(int, number)>("count # factor", SyntheticText(N * 7, 5))
+		.set_construct_as_smart_pointer(true);
+	AddSyntheticMethods(cls, N, cfg);
+
+	if(!groupName.empty())
+	{
+		reg.add_class_to_group(name, groupName, tag);
+		if(N % cfg.implsPerGroup == 0)
+			reg.get_class_group(groupName)->set_default_class(0);
+	}
+}
+
+/// registers the classes [Lo, Hi) by splitting the range in halves, which
+/// keeps the template instantiation depth logarithmic
+template<int Lo, int Hi, bool bLeaf = (Hi - Lo == 1)>
+struct SyntheticClassRegistrar
+{
+	static void register_classes(bridge::Registry &reg, const SyntheticRegistryConfig &cfg)
+	{
+		if((size_t) Lo >= cfg.numClasses) return;
+		SyntheticClassRegistrar<Lo, (Lo + Hi) / 2>::register_classes(reg, cfg);
+		SyntheticClassRegistrar<(Lo + Hi) / 2, Hi>::register_classes(reg, cfg);
+	}
+};
+
+template<int Lo, int Hi>
+struct SyntheticClassRegistrar<Lo, Hi, true>
+{
+	static void register_classes(bridge::Registry &reg, const SyntheticRegistryConfig &cfg)
+	{
+		if((size_t) Lo < cfg.numClasses)
+			RegisterSyntheticClass<Lo>(reg, cfg);
+	}
+};
+
+template<int Chunk>
+void RegisterSyntheticClassChunk(bridge::Registry &reg, const SyntheticRegistryConfig &cfg)
+{
+	const int lo = Chunk * UG_DOCUGEN_SYNTHETIC_CHUNK_SIZE;
+	const int end = (Chunk + 1) * UG_DOCUGEN_SYNTHETIC_CHUNK_SIZE;
+	const int hi = end < UG_DOCUGEN_SYNTHETIC_TYPES ? end : UG_DOCUGEN_SYNTHETIC_TYPES;
+	SyntheticClassRegistrar<lo, hi>::register_classes(reg, cfg);
+}
+
+#ifdef UG_DOCUGEN_SYNTHETIC_CHUNK
+template void RegisterSyntheticClassChunk<UG_DOCUGEN_SYNTHETIC_CHUNK>(bridge::Registry &reg,
+		const SyntheticRegistryConfig &cfg);
+#endif
+
+}	// namespace DocuGen
+}	// namespace ug
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2013-2016:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+
+#ifndef __UG__DOCUGEN__SYNTHETIC_CLASSES_H
+#define __UG__DOCUGEN__SYNTHETIC_CLASSES_H
+
+#include <string>
+#include "registry/registry.h"
+#include "synthetic_registry.h"
+
+namespace ug
+{
+namespace DocuGen
+{
+
+/// \addtogroup apps_ugdocu
+/// \{
+
+/// maximal length of an inheritance chain of synthetic classes
+static const int SYNTHETIC_CHAIN_LENGTH = 8;
+/// number of distinct signatures available for overloads
+static const size_t SYNTHETIC_NUM_SIGNATURES = 5;
+
+/// common base of all synthetic classes, used as parameter type
+class SyntheticRoot
+{
+	public:
+		virtual ~SyntheticRoot() {}
+};
+
+/// a few words of solver vocabulary, so that docu texts differ in a reproducible way
+std::string SyntheticText(size_t seed, size_t numWords);
+
+/// registry group of the i-th synthetic class or function
+std::string SyntheticRegistryGroup(size_t i, const SyntheticRegistryConfig &cfg);
+
+/// name, class group and tag of the i-th synthetic class
+void SyntheticClassName(size_t i, const SyntheticRegistryConfig &cfg,
+		std::string &name, std::string &groupName, std::string &tag);
+
+/**
+ * \brief Registers the synthetic classes of one chunk
+ * \details Chunk k holds the classes [k, k+1) * UG_DOCUGEN_SYNTHETIC_CHUNK_SIZE,
+ *   as far as they are below cfg.numClasses. Defined and instantiated in
+ *   synthetic_class_chunk.cpp, which is compiled once per chunk, so that the
+ *   class templates of a large registry are spread over many translation units.
+ */
+template<int Chunk>
+void RegisterSyntheticClassChunk(bridge::Registry &reg, const SyntheticRegistryConfig &cfg);
+
+// end group apps_ugdocu
+/// \}
+
+}	// namespace DocuGen
+}	// namespace ug
+
+#endif	// __UG__DOCUGEN__SYNTHETIC_CLASSES_H
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2013-2016:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "common/log.h"
+#include "common/error.h"
+#include "registry/registry.h"
+
+#include "ugdocu_options.h"
+#include "synthetic_registry.h"
+#include "synthetic_classes.h"
+
+using namespace std;
+
+namespace ug
+{
+namespace DocuGen
+{
+
+/// global function signatures
+static void SyntheticFunction0() {}
+static number SyntheticFunction1(number, int) { return 0; }
+static std::string SyntheticFunction2(const char *) { return ""; }
+static bool SyntheticFunction3(SmartPtr<SyntheticRoot>) { return true; }
+static SmartPtr<SyntheticRoot> SyntheticFunction4(size_t, bool) { return SmartPtr<SyntheticRoot>(); }
+
+SyntheticRegistryConfig::SyntheticRegistryConfig() :
+	  numClasses( 200 )
+	, numClassGroups( 20 )
+	, implsPerGroup( 4 )
+	, inheritanceDepth( 4 )
+	, methodsPerClass( 8 )
+	, overloadsPerMethod( 2 )
+	, numFunctions( 200 )
+	, overloadsPerFunction( 2 )
+	, numRegistryGroups( 20 )
+{}
+
+void SyntheticRegistryConfig::parse(const string &str)
+{
+	vector<pair<string, string> > entries;
+	ParseOptionString(str, entries);
+	for(size_t i=0; i<entries.size(); i++)
+	{
+		const string &key = entries[i].first;
+		const string &value = entries[i].second;
+		if(key == "classes")
+			numClasses = OptionToSize(key, value, numClasses);
+		else if(key == "classGroups")
+			numClassGroups = OptionToSize(key, value, numClassGroups);
+		else if(key == "implsPerGroup")
+			implsPerGroup = OptionToSize(key, value, implsPerGroup);
+		else if(key == "depth")
+			inheritanceDepth = OptionToSize(key, value, inheritanceDepth);
+		else if(key == "methods")
+			methodsPerClass = OptionToSize(key, value, methodsPerClass);
+		else if(key == "methodOverloads")
+			overloadsPerMethod = OptionToSize(key, value, overloadsPerMethod);
+		else if(key == "functions")
+			numFunctions = OptionToSize(key, value, numFunctions);
+		else if(key == "functionOverloads")
+			overloadsPerFunction = OptionToSize(key, value, overloadsPerFunction);
+		else if(key == "registryGroups")
+			numRegistryGroups = OptionToSize(key, value, numRegistryGroups);
+		else
+			UG_WARNING("DocuGen: unknown synthetic registry option '" << key << "' ignored.\n");
+	}
+
+	if(numClasses > UG_DOCUGEN_SYNTHETIC_TYPES)
+	{
+		UG_WARNING("DocuGen: only " << UG_DOCUGEN_SYNTHETIC_TYPES << " synthetic classes available"
+				" (rebuild with a larger DOCUGEN_SYNTHETIC_TYPES), using that many.\n");
+		numClasses = UG_DOCUGEN_SYNTHETIC_TYPES;
+	}
+	numClassGroups = min(numClassGroups, implsPerGroup == 0 ? 0 : numClasses / implsPerGroup);
+	inheritanceDepth = min(inheritanceDepth, (size_t) SYNTHETIC_CHAIN_LENGTH);
+	overloadsPerMethod = max((size_t) 1, min(overloadsPerMethod, SYNTHETIC_NUM_SIGNATURES));
+	overloadsPerFunction = max((size_t) 1, min(overloadsPerFunction, SYNTHETIC_NUM_SIGNATURES));
+	numRegistryGroups = max((size_t) 1, numRegistryGroups);
+}
+
+string SyntheticText(size_t seed, size_t numWords)
+{
+	static const char *words[] = {
+		"solver", "grid", "preconditioner", "matrix", "vector", "assemble",
+		"domain", "subset", "refinement", "smoother", "defect", "iteration",
+		"boundary", "element", "discretization", "approximation", "space",
+		"function", "parallel", "layout", "norm", "convergence", "damping",
+		"restriction", "prolongation", "time", "step", "output", "file", "value"
+	};
+	const size_t numVocabulary = sizeof(words) / sizeof(words[0]);
+	stringstream ss;
+	for(size_t i=0; i<numWords; i++)
+	{
+		seed = seed * 1103515245 + 12345;
+		if(i > 0) ss << " ";
+		ss << words[(seed >> 8) % numVocabulary];
+	}
+	return ss.str();
+}
+
+string SyntheticRegistryGroup(size_t i, const SyntheticRegistryConfig &cfg)
+{
+	size_t g = i % cfg.numRegistryGroups;
+	stringstream ss;
+	if(g % 4 == 3)
+		ss << "(Plugin) Synthetic" << g << "/Group" << g;
+	else
+		ss << "Synthetic/Group" << g;
+	return ss.str();
+}
+
+void SyntheticClassName(size_t i, const SyntheticRegistryConfig &cfg,
+		string &name, string &groupName, string &tag)
+{
+	stringstream ss;
+	if(i < cfg.numClassGroups * cfg.implsPerGroup)
+	{
+		size_t impl = i % cfg.implsPerGroup;
+		size_t dim = impl % 3 + 1;
+		size_t algebra = impl / 3 + 1;
+
+		ss << "SyntheticGroup" << i / cfg.implsPerGroup;
+		groupName = ss.str();
+		ss << dim << "dCPU" << algebra;
+		name = ss.str();
+
+		stringstream tagStream;
+		tagStream << "dim=" << dim << "d;algebra=CPU" << algebra << ";";
+		tag = tagStream.str();
+	}
+	else
+	{
+		ss << "SyntheticClass" << i;
+		name = ss.str();
+		groupName = "";
+		tag = "";
+	}
+}
+
+/// registers the chunks [Lo, Hi) of synthetic classes by splitting the range
+/// in halves, like SyntheticClassRegistrar does for the classes of a chunk
+template<int Lo, int Hi, bool bLeaf = (Hi - Lo == 1)>
+struct SyntheticChunkRegistrar
+{
+	static void register_chunks(bridge::Registry &reg, const SyntheticRegistryConfig &cfg)
+	{
+		if((size_t) Lo * UG_DOCUGEN_SYNTHETIC_CHUNK_SIZE >= cfg.numClasses) return;
+		SyntheticChunkRegistrar<Lo, (Lo + Hi) / 2>::register_chunks(reg, cfg);
+		SyntheticChunkRegistrar<(Lo + Hi) / 2, Hi>::register_chunks(reg, cfg);
+	}
+};
+
+template<int Lo, int Hi>
+struct SyntheticChunkRegistrar<Lo, Hi, true>
+{
+	static void register_chunks(bridge::Registry &reg, const SyntheticRegistryConfig &cfg)
+	{
+		if((size_t) Lo * UG_DOCUGEN_SYNTHETIC_CHUNK_SIZE < cfg.numClasses)
+			RegisterSyntheticClassChunk<Lo>(reg, cfg);
+	}
+};
+
+static void RegisterSyntheticFunctions(bridge::Registry &reg, const SyntheticRegistryConfig &cfg)
+{
+	for(size_t i=0; i<cfg.numFunctions; i++)
+	{
+		stringstream ss;
+		ss << "SyntheticFunction" << i;
+		string name = ss.str();
+		string grp = SyntheticRegistryGroup(i, cfg);
+		string tooltip = SyntheticText(i * 31, 5);
+		string help = SyntheticText(i * 61, 14);
+
+		for(size_t o=0; o<cfg.overloadsPerFunction; o++)
+		{
+			switch(o)
+			{
+				case 0: reg.add_function(name, &SyntheticFunction0, grp, "", "", tooltip, help); break;
+				case 1: reg.add_function(name, &SyntheticFunction1, grp, "result", "factor # count", tooltip, help); break;
+				case 2: reg.add_function(name, &SyntheticFunction2, grp, "text", "filename", tooltip, help); break;
+				case 3: reg.add_function(name, &SyntheticFunction3, grp, "success", "object", tooltip, help); break;
+				case 4: reg.add_function(name, &SyntheticFunction4, grp, "object", "size # flag", tooltip, help); break;
+			}
+		}
+	}
+}
+
+size_t PopulateSyntheticRegistry(bridge::Registry &reg, const SyntheticRegistryConfig &cfg)
+{
+	static bool bPopulated = false;
+	static size_t numRegistered = 0;
+	if(bPopulated)
+	{
+		UG_WARNING("DocuGen: synthetic registry already populated, keeping the first configuration.\n");
+		return numRegistered;
+	}
+
+	try{
+		reg.add_class_<SyntheticRoot>("SyntheticRoot", "Synthetic", "common base of synthetic classes");
+		SyntheticChunkRegistrar<0, UG_DOCUGEN_SYNTHETIC_CHUNKS>::register_chunks(reg, cfg);
+		RegisterSyntheticFunctions(reg, cfg);
+		reg.registry_changed();
+	}UG_CATCH_THROW_FUNC();
+
+	bPopulated = true;
+	numRegistered = cfg.numClasses;
+	UG_LOG("Synthetic registry: " << cfg.numClasses << " classes, " << cfg.numClassGroups << " class groups, "
+			<< cfg.numFunctions << " functions in " << cfg.numRegistryGroups << " groups.\n");
+	return numRegistered;
+}
+
+}	// namespace DocuGen
+}	// namespace ug
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2013-2016:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __UG__DOCUGEN__SYNTHETIC_REGISTRY_H
+#define __UG__DOCUGEN__SYNTHETIC_REGISTRY_H
+
+#include <string>
+#include "registry/registry.h"
+
+/// number of distinct C++ types available for synthetic classes.
+/// The ug4 registry names every C++ type only once, so every registered class
+/// needs its own type. This bounds the class count and is the main factor of
+/// the compile time, which is spread over chunks of UG_DOCUGEN_SYNTHETIC_CHUNK_SIZE
+/// types (see synthetic_class_chunk.cpp).
+#ifndef UG_DOCUGEN_SYNTHETIC_TYPES
+#define UG_DOCUGEN_SYNTHETIC_TYPES 100000
+#endif
+
+/// number of synthetic types per translation unit, a multiple of 8
+#ifndef UG_DOCUGEN_SYNTHETIC_CHUNK_SIZE
+#define UG_DOCUGEN_SYNTHETIC_CHUNK_SIZE 1024
+#endif
+
+#define UG_DOCUGEN_SYNTHETIC_CHUNKS \
+	((UG_DOCUGEN_SYNTHETIC_TYPES + UG_DOCUGEN_SYNTHETIC_CHUNK_SIZE - 1) / UG_DOCUGEN_SYNTHETIC_CHUNK_SIZE)
+
+namespace ug
+{
+namespace DocuGen
+{
+
+/// \addtogroup apps_ugdocu
+/// \{
+
+/**
+ * \brief Shape of a synthetic registry used for benchmarking the generators
+ * \details Parsed from a ';'-separated option string like
+ *   <tt>"classes=400;classGroups=50;implsPerGroup=4;depth=4"</tt>.
+ *   The first classGroups*implsPerGroup classes are implementations of class
+ *   groups (tagged like real dim/algebra specializations), the others are
+ *   plain classes. Classes form inheritance chains of at most 8 classes.
+ */
+class SyntheticRegistryConfig
+{
+	public:
+		SyntheticRegistryConfig();
+
+		void parse(const std::string &str);
+
+		/// number of classes, at most UG_DOCUGEN_SYNTHETIC_TYPES
+		size_t numClasses;
+		/// number of class groups
+		size_t numClassGroups;
+		/// number of tagged implementations in every class group
+		size_t implsPerGroup;
+		/// length of the inheritance chains, 0..8
+		size_t inheritanceDepth;
+		/// number of method names per class, every 4th is const
+		size_t methodsPerClass;
+		/// number of overloads per non-const method name, 1..5
+		size_t overloadsPerMethod;
+		/// number of global function names
+		size_t numFunctions;
+		/// number of overloads per global function name, 1..5
+		size_t overloadsPerFunction;
+		/// number of registry groups, every 4th is a plugin group
+		size_t numRegistryGroups;
+};
+
+/**
+ * \brief Registers classes, class groups and functions described by cfg
+ * \details Everything is registered below the registry groups
+ *   "Synthetic/Group<i>" and "(Plugin) Synthetic<i>". The registry can only
+ *   be populated once per process, further calls are ignored with a warning.
+ * \returns number of registered classes
+ */
+size_t PopulateSyntheticRegistry(bridge::Registry &reg, const SyntheticRegistryConfig &cfg);
+
+// end group apps_ugdocu
+/// \}
+
+}	// namespace DocuGen
+}	// namespace ug
+
+#endif	// __UG__DOCUGEN__SYNTHETIC_REGISTRY_H
@@ -32,6 +32,8 @@
 
 #include "ug_docu_class_description.h"
 #include "ugdocu_misc.h"
+#include "ugdocu_log.h"
+#include "docugen_session.h"
 using namespace std;
 using namespace ug;
 using namespace bridge;
@@ -42,10 +44,6 @@ namespace ug
 namespace DocuGen
 {
 
-extern vector<UGDocuClassDescription> classes;
-extern vector<UGDocuClassDescription> classesAndGroups;
-extern vector<UGDocuClassDescription> classesAndGroupsAndImplementations;
-
 bool NameSortFunction(const UGDocuClassDescription &i, const UGDocuClassDescription &j)
 {
 	return i.name().compare(j.name()) < 0;
@@ -75,11 +73,12 @@ UGDocuClassDescription *GetUGDocuClassDescription(std::vector<UGDocuClassDescrip
 void GetGroups(std::map<string, UGRegistryGroup> &g)
 {
 	try{
+	const vector<UGDocuClassDescription> &classesAndGroups = GetDocuGenSession().classesAndGroups;
 	for(size_t i=0; i<classesAndGroups.size(); i++)
 	{
 		string group = classesAndGroups[i].group_str();
-		g[group].classesAndGroups.push_back(classesAndGroups[i]);
-		UG_LOG("CLASS: " << group << " " << classesAndGroups[i].name() << "\n");
+		g[group].classesAndGroups.push_back(&classesAndGroups[i]);
+		DOCUGEN_LOG(LL_TRACE, "CLASS: " << group << " " << classesAndGroups[i].name() << "\n");
 	}
 
 	Registry &reg = GetUGRegistry();
@@ -91,7 +90,7 @@ void GetGroups(std::map<string, UGRegistryGroup> &g)
 		for(size_t j=0; j<fu.num_overloads(); j++)
 		{
 			g[fu.get_overload(j)->group()].functions.push_back(fu.get_overload(j));
-			UG_LOG("FUNCTION: " << fu.get_overload(j)->group() << " " << fu.get_overload(j)->name() << "\n");
+			DOCUGEN_LOG(LL_TRACE, "FUNCTION: " << fu.get_overload(j)->group() << " " << fu.get_overload(j)->name() << "\n");
 		}
 	}
 
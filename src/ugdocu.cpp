@@ -30,6 +30,8 @@
  * GNU Lesser General Public License for more details.
  */
 
+#include <cstdio>
+#include <cstdlib>
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -40,6 +42,7 @@
 #include "bindings/lua/lua_util.h"
 #include "registry/class_helper.h"
 #include "common/util/parameter_parsing.h"
+#include "common/util/file_util.h"
 #include "compile_info/compile_info.h"
 
 #ifdef UG_BRIDGE
@@ -54,9 +57,23 @@
 #endif
 
 #include "ugdocu_misc.h"
+#include "ugdocu_options.h"
 #include "class_hierarchy_provider.h"
+#include "completion_index.h"
+#include "ugdocu_profiling.h"
+#include "ugdocu_parallel.h"
+#include "ugdocu_log.h"
+#include "docugen_session.h"
+#include "ugdocu_filter.h"
 #include "html_generation.h"
 #include "cpp_generator.h"
+#include "output_file.h"
+#include "output_sink.h"
+#include "docu_server.h"
+#ifdef UG_DOCUGEN_BENCHMARK
+# include "synthetic_registry.h"
+# include "microbenchmark.h"
+#endif
 
 using namespace std;
 using namespace ug;
@@ -102,36 +119,267 @@ namespace DocuGen
  *     by Doxygen
  *   - bool generateList<br />
  *     generates completion list
+ *   - string options (optional)<br />
+ *     ';'-separated list of additional options, see DocuGenOptions. Available are
+ *     - <tt>completionShards</tt>: write the completion list as one file per
+ *       registry group or plugin plus a manifest
+ *     - <tt>completionReferences</tt>: completion format version 2, classgroups
+ *       and inherited member functions are referenced instead of repeated
+ *     - <tt>profile</tt>: write wall/cpu time, peak memory, files and bytes of
+ *       every phase to docugen_profile.json next to the outputs
+ *     - <tt>trace</tt>: write spans of all phases, pages, C++ files, completion
+ *       entries and file writes to docugen_trace.json (Chrome trace-event format)
+ *     - <tt>threads=N</tt>: write class pages, C++ files and completion shards
+ *       with N threads, 0 uses all hardware threads (default 1, at most 256)
+ *     - <tt>completionDir=path</tt>: write the completion list/shards to path
+ *       instead of ROOT_PATH/plugins/DocuGen
+ *     - <tt>configs=2:CPU1,3:CPU1,...</tt>: document several dimension/algebra
+ *       configurations in one run, pages mark for which configurations a class
+ *       is the default implementation of its class group
+ *     - <tt>log=level</tt>: <tt>quiet</tt> (default if silent), <tt>progress</tt>
+ *       (default otherwise, one counter per phase), <tt>verbose</tt> (every
+ *       written file) or <tt>trace</tt> (every registered class and function)
+ *     - <tt>cache=false</tt>: don't reuse the state of earlier calls in this
+ *       ugshell session. By default, a second call (e.g. after loading another
+ *       plugin) only rebuilds the class descriptions if the registry changed,
+ *       reuses the rendered member functions of unchanged classes and doesn't
+ *       rewrite files whose content is unchanged
+ *     - <tt>include=ug4/Grid*,...</tt>, <tt>exclude=...</tt>: only document
+ *       the registry groups (and their subgroups) matching one of the include
+ *       and none of the exclude patterns, wildcards are '*' and '?'. Base
+ *       classes and classes used in parameters are documented as well, so
+ *       that all links work. The indices list only the selected entries, so
+ *       the output directory must not hold the docu of an unfiltered run.
+ *       The completion list of the selected entries is written to
+ *       myUg4CompletionList_filtered.txt, completion shards of other groups
+ *       are kept.
+ *     - <tt>plugins=ConvectionDiffusion,...</tt>: shorthand for including the
+ *       groups <tt>(Plugin) ConvectionDiffusion</tt>
+ *     - <tt>indexShards</tt>: split index.html and functions.html into one
+ *       page per first letter (index_A.html, ...), groupindex.html and
+ *       groupedfunctions.html into one page per registry group. The original
+ *       pages then only link to the shards with their number of entries.
+ *     - <tt>singlePage</tt>: write the HTML docu as ugdocu_data.json and the
+ *       viewer ugdocu.html, which renders all views in the browser. The
+ *       directory has to be served over HTTP for the viewer to load the data.
+ *     - <tt>compactMarkup</tt>: write the function and index tables with the
+ *       short CSS classes of ugdocu.css and without optional end tags
+ *     - <tt>gzip</tt>: write a compressed copy name.gz next to every output
+ *       file, for web servers sending pre-compressed files. Needs the cmake
+ *       option DOCUGEN_ZLIB. The completion manifest lists the compressed
+ *       sizes of the shards.
+ *     - <tt>gzipMinSize=1024</tt>: files below this size are not compressed
+ *     - <tt>sink=tar</tt> or <tt>sink=pack</tt>: write all files into one
+ *       archive instead of the file system (see OpenOutputSink), names are
+ *       relative to baseDir. Every call writes the complete documentation.
+ *     - <tt>sinkFile=...</tt>: the archive, <tt>-</tt> is stdout (the log is
+ *       then disabled), default is ugdocu.tar or ugdocu.pack in baseDir
+ *     - <tt>serveCacheSize=256</tt>: pages ServeScriptReferenceDocu keeps
+ *       in memory
+ *
+ *   Returns 0 on success and 1 if the generation failed.
+ *
+ *   When started with several processes (e.g. <tt>mpirun -np 4 ugshell ...</tt>),
+ *   the class pages, group pages, C++ files and completion shards are
+ *   partitioned among the processes. Rank 0 writes the index pages, the
+ *   global functions, the completion list and the shard manifest. Profiling
+ *   reports and traces get the rank in their name (docugen_profile.1.json).
  * \{
  */
 
 void WriteCompletionList(std::vector<UGDocuClassDescription> &classesAndGroupsAndImplementations, bool bSilent, ClassHierarchy &hierarchy);
+void WriteCompletionShards(std::vector<UGDocuClassDescription> &classesAndGroupsAndImplementations, bool bSilent, ClassHierarchy &hierarchy);
 
 
-vector<UGDocuClassDescription> classes;
-vector<UGDocuClassDescription> classesAndGroups;
-vector<UGDocuClassDescription> classesAndGroupsAndImplementations;
 
 // end group apps_ugdocu
 /// \}
 
 }	// namespace DocuGen
 
+/// 	init registry with cpualgebra and dim == 2
+static void InitDefaultAlgebra()
+{
+#if defined UG_CPU_1
+	AlgebraType algebra("CPU", 1);
+#elif defined UG_CRS_1
+	AlgebraType algebra("CRS", 1);
+#else
+# error "No suitable Algebra found."
+#endif
+	const int dim = 2;
+	InitUG(dim, algebra);
+}
+
+/// parses a configuration "dim:ALGEBRA" like "2:CPU1"
+static bool ParseConfiguration(const string &str, int &dim, string &type, int &blockSize)
+{
+	size_t colon = str.find(':');
+	if(colon == string::npos) return false;
+	dim = atoi(str.substr(0, colon).c_str());
+	string algebra = TrimString(str.substr(colon+1));
+	size_t digits = algebra.find_first_of("0123456789");
+	if(dim < 1 || dim > 3 || digits == 0 || digits == string::npos) return false;
+	type = algebra.substr(0, digits);
+	blockSize = atoi(algebra.substr(digits).c_str());
+	return blockSize > 0;
+}
+
+/**
+ * Calls InitUG for every ','-separated configuration of the option configs
+ * and records the default classes of the class groups for each. All
+ * specializations are registered independent of InitUG, so one generation
+ * pass documents all configurations; only the default classes differ and are
+ * annotated. The first valid configuration stays initialized. Without
+ * configs, the default algebra is used.
+ */
+static void InitConfigurations(const string &configs)
+{
+	DocuGen::ClearDefaultClasses();
+	vector<string> entries;
+	if(!configs.empty())
+		TokenizeString(configs, entries, ',');
+
+	int firstDim = 0, firstBlockSize = 0;
+	string firstType;
+	for(size_t i=0; i<entries.size(); i++)
+	{
+		int dim, blockSize;
+		string type;
+		if(!ParseConfiguration(TrimString(entries[i]), dim, type, blockSize))
+		{
+			UG_WARNING("DocuGen: configuration '" << entries[i] << "' ignored, expected dim:ALGEBRA like 2:CPU1.\n");
+			continue;
+		}
+		try
+		{
+			InitUG(dim, AlgebraType(type.c_str(), blockSize));
+		}
+		catch(UGError &err)
+		{
+			UG_WARNING("DocuGen: configuration '" << entries[i] << "' not available: " << err.get_msg(0) << "\n");
+			continue;
+		}
+		stringstream label;
+		label << dim << "d " << type << blockSize;
+		DocuGen::RecordDefaultClasses(label.str());
+		if(firstDim == 0)
+		{
+			firstDim = dim;
+			firstType = type;
+			firstBlockSize = blockSize;
+		}
+	}
+
+	if(firstDim == 0)
+	{
+		if(!entries.empty())
+			UG_WARNING("DocuGen: no valid configuration, using the default algebra.\n");
+		InitDefaultAlgebra();
+		return;
+	}
+	InitUG(firstDim, AlgebraType(firstType.c_str(), firstBlockSize));
+}
+
+/// the lua bridge functions can only be registered once per process
+static void RegisterLuaBridgeOnce()
+{
+	static bool bRegistered = false;
+	if(bRegistered) return;
+	ug::script::RegisterDefaultLuaBridge(&bridge::GetUGRegistry());
+	bRegistered = true;
+}
+
+/// the session, cleared if the options don't allow to reuse it
+static DocuGen::DocuGenSession &GetReusableSession()
+{
+	const DocuGen::DocuGenOptions &opt = DocuGen::GetDocuGenOptions();
+	// the cached fragments of the class pages are rendered in one markup
+	static bool bLastCompactMarkup = false;
+	DocuGen::DocuGenSession &session = DocuGen::GetDocuGenSession();
+	if(!opt.cache || opt.compactMarkup != bLastCompactMarkup)
+		session.clear();
+	bLastCompactMarkup = opt.compactMarkup;
+	return session;
+}
+
+/**
+ * A filtered run writes indices of the selected classes only, they must not
+ * replace the complete indices of an unfiltered run. Filtered runs mark
+ * their output directory with docugen_filter.txt and refuse directories
+ * holding an unfiltered docu, unfiltered runs remove the mark.
+ */
+static void CheckFilteredOutputDir(const string &dir)
+{
+	const DocuGen::DocuGenOptions &opt = DocuGen::GetDocuGenOptions();
+	string marker = dir + "docugen_filter.txt";
+	if(!DocuGen::GetDocuGenFilter().is_active())
+	{
+		if(DocuGen::IsOutputRank() && DocuGen::OutputFileExists(marker))
+			remove(marker.c_str());
+		return;
+	}
+	if(!DocuGen::OutputFileExists(marker)
+			&& (DocuGen::OutputFileExists(dir + "index.html")
+				|| DocuGen::OutputFileExists(dir + "ugdocu_data.json")
+				|| DocuGen::OutputFileExists(dir + "global_functions.cpp")))
+		UG_THROW("DocuGen: '" << dir << "' holds the docu of all groups, the options include, exclude"
+				" and plugins would replace its indices by partial ones. Use another directory.");
+	if(DocuGen::IsOutputRank())
+	{
+		DocuGen::OutputFile f(marker);
+		f << "include=" << opt.includeGroups << "\nexclude=" << opt.excludeGroups << "\nplugins=" << opt.plugins << "\n";
+	}
+}
+
+/**
+ * whether options let OpenOutputSink write an archive to stdout. Checked
+ * before the options are parsed, since nothing must be logged to stdout then.
+ */
+static bool ArchiveOnStdout(const char *options)
+{
+	vector<pair<string, string> > entries;
+	DocuGen::ParseOptionString(options, entries);
+	string sink, sinkFile;
+	for(size_t i=0; i<entries.size(); i++)
+	{
+		if(entries[i].first == "sink")
+			sink = entries[i].second;
+		else if(entries[i].first == "sinkFile")
+			sinkFile = entries[i].second;
+	}
+	return (sink == "tar" || sink == "pack") && sinkFile == "-" && DocuGen::GetDocuGenNumRanks() == 1;
+}
+
 /// \addtogroup DocuGen
 int GenerateScriptReferenceDocu(
 		const char* baseDir,
 		bool silent,
 		bool genHtml,
 		bool genCpp,
-		bool genList)
+		bool genList,
+		const char* options)
 {
 	int errors = 0;
-	if(silent)
+	bool bFailed = false;
+	// the log would be mixed into an archive on stdout, also warnings about the options
+	if(silent || ArchiveOnStdout(options))
 		GetLogAssistant().enable_terminal_output(false);
+	DocuGen::DocuGenOptions &opt = DocuGen::GetDocuGenOptions();
+	opt = DocuGen::DocuGenOptions();
+	opt.parse(options);
+	DocuGen::ResetProfiling();
+	DocuGen::EnableTracing(opt.trace);
+	DocuGen::LogLevel logLevel = silent ? DocuGen::LL_QUIET : DocuGen::LL_PROGRESS;
+	if(!opt.logLevel.empty())
+		DocuGen::ParseLogLevel(opt.logLevel, logLevel);
+	DocuGen::SetLogLevel(logLevel);
 	try
 	{
 
-		ug::script::RegisterDefaultLuaBridge(&bridge::GetUGRegistry());
+		RegisterLuaBridgeOnce();
+
+		DocuGen::DocuGenSession &session = GetReusableSession();
 
 		LOG("****************************************************************\n");
 		LOG("* ugdocu - v0.2.0\n");
@@ -148,37 +396,51 @@ int GenerateScriptReferenceDocu(
 			}
 		}
 
+		{
+			string sinkFile = opt.sinkFile.empty() ? dir + "ugdocu." + opt.sink : opt.sinkFile;
+			DocuGen::OpenOutputSink(opt.sink, sinkFile, dir);
+		}
+
+		// the configurations select the default classes, the session has to
+		// see them when it decides whether the registry changed
+		{
+			DocuGen::PhaseTimer phase("InitUG");
+			InitConfigurations(opt.configurations);
+		}
+
 		if ( genHtml || genList ) {
-			DocuGen::GetGroups(DocuGen::classes, DocuGen::classesAndGroups, DocuGen::classesAndGroupsAndImplementations);
+			DocuGen::PhaseTimer phase("GetGroups");
+			if(!session.update())
+				UG_LOG("Registry unchanged, reusing cached class descriptions.\n");
 		}
 
 		Registry &reg = GetUGRegistry();
 		ClassHierarchy hierarchy;
 
-		// 	init registry with cpualgebra and dim == 2
-	#if defined UG_CPU_1
-		AlgebraType algebra("CPU", 1);
-	#elif defined UG_CRS_1
-		AlgebraType algebra("CRS", 1);
-	#else
-	# error "No suitable Algebra found."
-	#endif
-		const int dim = 2;
-		InitUG(dim, algebra);
+		{
+			DocuGen::PhaseTimer phase("Filter");
+			DocuGen::GetDocuGenFilter().init(opt.includeGroups, opt.excludeGroups, opt.plugins);
+		}
+
+		if ( genHtml || genCpp )
+			CheckFilteredOutputDir(dir);
 
 		if ( genHtml || genList ) {
+			DocuGen::PhaseTimer phase("GetClassHierarchy");
 			GetClassHierarchy( hierarchy, reg );
 			UG_LOG("GetClassHierarchy... ");
 			UG_LOG(hierarchy.subclasses.size() << " base classes, " << reg.num_class_groups() << " total. " << endl);
 		}
 
 		if ( genHtml ) {
+			DocuGen::PhaseTimer phase("WriteHTMLDocu");
 			// Write HTML docu
 			LOG("Writing html files to \"" << dir << "\"" << endl);
-			DocuGen::WriteHTMLDocu(DocuGen::classes, DocuGen::classesAndGroups, dir.c_str(), hierarchy);
+			DocuGen::WriteHTMLDocu(session.classes, session.classesAndGroups, dir.c_str(), hierarchy);
 		}
 
 		if ( genCpp ) {
+			DocuGen::PhaseTimer phase("CppGenerator::generate_cpp_files");
 			DocuGen::ClassHierarchyProvider chp;
 			chp.init( reg );
 			// Write C++ files
@@ -187,18 +449,48 @@ int GenerateScriptReferenceDocu(
 		}
 
 		if ( genList ) {
-			DocuGen::WriteCompletionList(DocuGen::classesAndGroupsAndImplementations, silent, hierarchy);
+			DocuGen::PhaseTimer phase("WriteCompletionList");
+			if ( opt.completionShards )
+				DocuGen::WriteCompletionShards(session.classesAndGroupsAndImplementations, silent, hierarchy);
+			else if ( DocuGen::IsOutputRank() )
+				DocuGen::WriteCompletionList(session.classesAndGroupsAndImplementations, silent, hierarchy);
+		}
+
+		DocuGen::CloseOutputSink();
+
+		// all files are written when the call returns on any process
+		DocuGen::SynchronizeDocuGenRanks();
+
+		string reportDir = (genHtml || genCpp) ? dir : PathProvider::get_path(ROOT_PATH) + "/plugins/DocuGen/";
+		string reportSuffix = ".json";
+		if ( DocuGen::GetDocuGenNumRanks() > 1 ) {
+			stringstream ss;
+			ss << "." << DocuGen::GetDocuGenRank() << ".json";
+			reportSuffix = ss.str();
+		}
+		if ( opt.profile )
+			DocuGen::WriteProfilingReport(reportDir + "docugen_profile" + reportSuffix);
+		if ( opt.trace ) {
+			DocuGen::WriteTraceEvents(reportDir + "docugen_trace" + reportSuffix);
+			DocuGen::EnableTracing(false);
 		}
 
 	}
 	catch(UGError &err)
 	{
 		errors &= 4;
+		bFailed = true;
 		PathProvider::clear_current_path_stack();
+		// finish a started archive, so that the files written so far can be read
+		try { DocuGen::CloseOutputSink(); } catch(UGError &) {}
+		// the next call must not record into the spans of this one
+		DocuGen::EnableTracing(false);
 		UG_ERR_LOG("UGError in Docu Generation:\n");
 
 		for(size_t i=0; i<err.num_msg(); i++)
 			UG_ERR_LOG(err.get_file(i) << ":" << err.get_line(i) << " : " << err.get_msg(i) << "\n");
+		// the other processes would wait for this one in their next barrier
+		DocuGen::SynchronizeFailedDocuGenRank();
 	}
 
 	GetLogAssistant().enable_terminal_output(true);
@@ -217,6 +509,242 @@ int GenerateScriptReferenceDocu(
 		UG_LOG("------ ugdocu/ugshell Initialization Errors ---]]]\n\n");
 	}
 	
+	return bFailed ? 1 : 0;
+}
+
+int GenerateScriptReferenceDocu(
+		const char* baseDir,
+		bool silent,
+		bool genHtml,
+		bool genCpp,
+		bool genList)
+{
+	return GenerateScriptReferenceDocu(baseDir, silent, genHtml, genCpp, genList, "");
+}
+
+#ifdef UG_DOCUGEN_BENCHMARK
+/// \addtogroup DocuGen
+/**
+ * Populates the registry with synthetic classes, class groups and functions
+ * (see DocuGen::SyntheticRegistryConfig for synthOptions) and runs all
+ * generators on it with profiling enabled. The phase timings end up in
+ * baseDir/docugen_profile.json.
+ *
+ *     ugshell -call GenerateSyntheticDocu\(\"bench\", \"classes=400;functions=1000\", \"\"\)
+ */
+int GenerateSyntheticDocu(const char* baseDir, const char* synthOptions, const char* options)
+{
+	try{
+		DocuGen::SyntheticRegistryConfig cfg;
+		cfg.parse(synthOptions);
+		DocuGen::PopulateSyntheticRegistry(GetUGRegistry(), cfg);
+		if(!DirectoryExists(baseDir) && !CreateDirectory(baseDir))
+			UG_THROW("Could not create output directory '" << baseDir << "'.");
+	}
+	catch(UGError &err)
+	{
+		UG_ERR_LOG("UGError in synthetic registry:\n");
+		for(size_t i=0; i<err.num_msg(); i++)
+			UG_ERR_LOG(err.get_file(i) << ":" << err.get_line(i) << " : " << err.get_msg(i) << "\n");
+		return 1;
+	}
+
+	// completionDir comes last, the completion list of the synthetic registry
+	// must never replace the one of the real registry in ROOT_PATH/plugins/DocuGen
+	string allOptions = string(options) + ";profile;completionDir=" + baseDir;
+	return GenerateScriptReferenceDocu(baseDir, true, true, true, true, allOptions.c_str());
+}
+
+/// \addtogroup DocuGen
+/**
+ * Runs all generators on a synthetic registry once per entry of the
+ * ','-separated threadCounts and appends wall/cpu time, files, bytes, peak
+ * memory, throughput and parallel efficiency of every phase and its direct
+ * sub-phases to the CSV reportFile (see DocuGen::AppendScalingReport).
+ * Every run starts with cache=false, no report is written if one fails.
+ * A registry can only be populated once per process, so different registry
+ * sizes need one ugshell call each (see the docugenScaling target).
+ *
+ *     ugshell -call RunDocuGenScalingBenchmark\(\"bench\", \"classes=400\", \"1,2,4,8\", \"scaling.csv\"\)
+ */
+int RunDocuGenScalingBenchmark(const char* baseDir, const char* synthOptions, const char* threadCounts, const char* reportFile)
+{
+	vector<DocuGen::ScalingResult> results;
+	try{
+		DocuGen::SyntheticRegistryConfig cfg;
+		cfg.parse(synthOptions);
+		DocuGen::PopulateSyntheticRegistry(GetUGRegistry(), cfg);
+		if(!DirectoryExists(baseDir) && !CreateDirectory(baseDir))
+			UG_THROW("Could not create output directory '" << baseDir << "'.");
+
+		vector<string> counts;
+		TokenizeString(threadCounts, counts, ',');
+		for(size_t i=0; i<counts.size(); i++)
+		{
+			size_t threads = DocuGen::OptionToSize("threads", TrimString(counts[i]), 1);
+			// every thread count is a cold run, the session cache would reuse
+			// the pages of the previous one and skip the unchanged files
+			stringstream options;
+			options << "profile;completionShards;completionDir=" << baseDir << ";threads=" << threads << ";cache=false";
+			if(GenerateScriptReferenceDocu(baseDir, true, true, true, true, options.str().c_str()) != 0)
+				UG_THROW("Generation with " << threads << " threads failed.");
+
+			const vector<DocuGen::PhaseStatistics> &phases = DocuGen::GetPhaseStatistics();
+			for(size_t j=0; j<phases.size(); j++)
+			{
+				if(phases[j].depth > 1) continue;
+				DocuGen::ScalingResult r;
+				r.registry = synthOptions;
+				r.numClasses = GetUGRegistry().num_classes();
+				r.numFunctions = GetUGRegistry().num_functions();
+				r.threads = DocuGen::GetNumWorkerThreads();
+				r.phase = phases[j].name;
+				r.wallMS = phases[j].wallMS;
+				r.cpuMS = phases[j].cpuMS;
+				r.filesCreated = phases[j].filesCreated;
+				r.bytesWritten = phases[j].bytesWritten;
+				r.peakRSSKB = phases[j].processPeakRSSKB;
+				results.push_back(r);
+			}
+		}
+		DocuGen::AppendScalingReport(reportFile, results);
+	}
+	catch(UGError &err)
+	{
+		UG_ERR_LOG("UGError in scaling benchmark:\n");
+		for(size_t i=0; i<err.num_msg(); i++)
+			UG_ERR_LOG(err.get_file(i) << ":" << err.get_line(i) << " : " << err.get_msg(i) << "\n");
+		return 1;
+	}
+	return 0;
+}
+
+/// \addtogroup DocuGen
+/**
+ * Measures the rendering hot paths (see DocuGen::RunMicrobenchmarks) on a
+ * synthetic registry and writes ns per call to reportFile. With empty
+ * synthOptions, the classes registered by ug4 and its plugins are used.
+ * Allocations per call are only counted when called by the executable
+ * docugenMicrobenchmarkRunner, which replaces operator new.
+ *
+ *     ugshell -call RunDocuGenMicrobenchmarks\(\"classes=200\", \"micro.json\"\)
+ *     docugenMicrobenchmarkRunner classes=200 micro.json
+ */
+int RunDocuGenMicrobenchmarks(const char* synthOptions, const char* reportFile)
+{
+	try{
+		RegisterLuaBridgeOnce();
+		if(strlen(synthOptions) > 0)
+		{
+			DocuGen::SyntheticRegistryConfig cfg;
+			cfg.parse(synthOptions);
+			DocuGen::PopulateSyntheticRegistry(GetUGRegistry(), cfg);
+		}
+		DocuGen::GetDocuGenSession().update();
+		// measure the whole registry, also after a filtered generation
+		DocuGen::GetDocuGenFilter().init("", "", "");
+		InitDefaultAlgebra();
+
+		vector<DocuGen::MicrobenchmarkResult> results;
+		DocuGen::RunMicrobenchmarks(results);
+		DocuGen::WriteMicrobenchmarkReport(reportFile, results);
+	}
+	catch(UGError &err)
+	{
+		UG_ERR_LOG("UGError in microbenchmarks:\n");
+		for(size_t i=0; i<err.num_msg(); i++)
+			UG_ERR_LOG(err.get_file(i) << ":" << err.get_line(i) << " : " << err.get_msg(i) << "\n");
+		return 1;
+	}
+	return 0;
+}
+#endif
+
+/// \addtogroup DocuGen
+/**
+ * Builds an in-memory index of all registered classes and functions and
+ * answers completion queries on stdin/stdout until "quit" (see
+ * DocuGen::RunCompletionQueries). Terminal logging is disabled meanwhile, so
+ * stdout only carries answers.
+ *
+ *     ugshell -noterm -call ServeCompletionQueries\(\)
+ */
+int ServeCompletionQueries()
+{
+	GetLogAssistant().enable_terminal_output(false);
+	try
+	{
+		RegisterLuaBridgeOnce();
+		DocuGen::GetDocuGenSession().update();
+		InitDefaultAlgebra();
+
+		DocuGen::CompletionIndex index;
+		index.build(DocuGen::GetDocuGenSession().classesAndGroupsAndImplementations);
+		std::cout << "UG4COMPLETER SERVER VERSION 1 " << index.num_entries() << " entries\n\n";
+		std::cout.flush();
+		DocuGen::RunCompletionQueries(index, std::cin, std::cout);
+	}
+	catch(UGError &err)
+	{
+		GetLogAssistant().enable_terminal_output(true);
+		UG_ERR_LOG("UGError in completion server:\n");
+		for(size_t i=0; i<err.num_msg(); i++)
+			UG_ERR_LOG(err.get_file(i) << ":" << err.get_line(i) << " : " << err.get_msg(i) << "\n");
+		return 1;
+	}
+	GetLogAssistant().enable_terminal_output(true);
+	return 0;
+}
+
+/// \addtogroup DocuGen
+/**
+ * Serves the HTML docu over HTTP on the loopback interface instead of writing
+ * it, each page is rendered on its first request (see DocuGen::ServeHTMLDocu).
+ * address is a port like "8080", "127.0.0.1:8080" or "unix:/tmp/ugdocu.sock",
+ * options are the ones of GenerateScriptReferenceDocu (filters, configs,
+ * indexShards, compactMarkup, serveCacheSize). Returns when /quit is posted
+ * with the token logged at startup.
+ *
+ *     ugshell -call ServeScriptReferenceDocu\(\"8080\",\"\"\)
+ *     curl -X POST "http://127.0.0.1:8080/quit?<token>"
+ */
+int ServeScriptReferenceDocu(const char* address, const char* options)
+{
+	DocuGen::DocuGenOptions &opt = DocuGen::GetDocuGenOptions();
+	opt = DocuGen::DocuGenOptions();
+	opt.parse(options);
+	if(!opt.logLevel.empty())
+	{
+		DocuGen::LogLevel logLevel = DocuGen::LL_PROGRESS;
+		DocuGen::ParseLogLevel(opt.logLevel, logLevel);
+		DocuGen::SetLogLevel(logLevel);
+	}
+	// the pages are not written, so one process serves all of them
+	if(!DocuGen::IsOutputRank())
+		return 0;
+	try
+	{
+		RegisterLuaBridgeOnce();
+
+		DocuGen::DocuGenSession &session = GetReusableSession();
+		InitConfigurations(opt.configurations);
+		session.update();
+
+		DocuGen::GetDocuGenFilter().init(opt.includeGroups, opt.excludeGroups, opt.plugins);
+
+		Registry &reg = GetUGRegistry();
+		ClassHierarchy hierarchy;
+		GetClassHierarchy( hierarchy, reg );
+
+		DocuGen::ServeHTMLDocu(address, session.classes, session.classesAndGroups, hierarchy, opt.serveCacheSize);
+	}
+	catch(UGError &err)
+	{
+		UG_ERR_LOG("UGError in docu server:\n");
+		for(size_t i=0; i<err.num_msg(); i++)
+			UG_ERR_LOG(err.get_file(i) << ":" << err.get_line(i) << " : " << err.get_msg(i) << "\n");
+		return 1;
+	}
 	return 0;
 }
 
@@ -225,11 +753,49 @@ InitUGPlugin_DocuGen(Registry* reg, string grp)
 {
 	grp.append("/DocuGen");
 	reg->add_function (	"GenerateScriptReferenceDocu",
-						&GenerateScriptReferenceDocu,
+						static_cast<int (*)(const char*, bool, bool, bool, bool)>(&GenerateScriptReferenceDocu),
 						grp,
 						"",
 						"baseDir # silent # genHtml # genCpp # genList",
 						"generates scripting reference documentation.");
+	reg->add_function (	"GenerateScriptReferenceDocu",
+						static_cast<int (*)(const char*, bool, bool, bool, bool, const char*)>(&GenerateScriptReferenceDocu),
+						grp,
+						"",
+						"baseDir # silent # genHtml # genCpp # genList # options",
+						"generates scripting reference documentation with additional options.");
+	reg->add_function (	"ServeCompletionQueries",
+						&ServeCompletionQueries,
+						grp,
+						"",
+						"",
+						"answers ugIDE completion queries on stdin/stdout.");
+	reg->add_function (	"ServeScriptReferenceDocu",
+						&ServeScriptReferenceDocu,
+						grp,
+						"",
+						"address # options",
+						"serves the scripting reference documentation over HTTP, rendering pages on request.");
+#ifdef UG_DOCUGEN_BENCHMARK
+	reg->add_function (	"GenerateSyntheticDocu",
+						&GenerateSyntheticDocu,
+						grp,
+						"",
+						"baseDir # synthOptions # options",
+						"generates all outputs for a synthetic registry and writes a profile.");
+	reg->add_function (	"RunDocuGenMicrobenchmarks",
+						&RunDocuGenMicrobenchmarks,
+						grp,
+						"",
+						"synthOptions # reportFile",
+						"measures ns and allocations per call of the rendering functions.");
+	reg->add_function (	"RunDocuGenScalingBenchmark",
+						&RunDocuGenScalingBenchmark,
+						grp,
+						"",
+						"baseDir # synthOptions # threadCounts # reportFile",
+						"runs all generators for several thread counts and appends a CSV scaling table.");
+#endif
 }
 
 }	// namespace ug
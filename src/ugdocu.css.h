@@ -244,177 +244,194 @@ unsigned char ugdocu_css[] = {
   0x6f, 0x77, 0x20, 0x7b, 0x0a, 0x09, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e,
   0x67, 0x3a, 0x20, 0x38, 0x70, 0x78, 0x20, 0x32, 0x30, 0x70, 0x78, 0x3b,
   0x0a, 0x7d, 0x0a, 0x2e, 0x6d, 0x64, 0x65, 0x73, 0x63, 0x4c, 0x65, 0x66,
-  0x74, 0x20, 0x7b, 0x0a, 0x09, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69,
-  0x7a, 0x65, 0x3a, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x65, 0x72, 0x3b,
-  0x0a, 0x09, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c,
-  0x79, 0x3a, 0x20, 0x41, 0x72, 0x69, 0x61, 0x6c, 0x2c, 0x20, 0x48, 0x65,
-  0x6c, 0x76, 0x65, 0x74, 0x69, 0x63, 0x61, 0x2c, 0x20, 0x73, 0x61, 0x6e,
-  0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3b, 0x0a, 0x09, 0x62, 0x61,
-  0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c,
-  0x6f, 0x72, 0x3a, 0x20, 0x23, 0x46, 0x41, 0x46, 0x41, 0x46, 0x41, 0x3b,
-  0x0a, 0x09, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x2d, 0x6c, 0x65,
-  0x66, 0x74, 0x3a, 0x20, 0x38, 0x70, 0x78, 0x3b, 0x0a, 0x09, 0x62, 0x6f,
-  0x72, 0x64, 0x65, 0x72, 0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x20, 0x31, 0x70,
-  0x78, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x20, 0x23, 0x45, 0x30, 0x45, 0x30,
-  0x45, 0x30, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d,
-  0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 0x6e,
-  0x6f, 0x6e, 0x65, 0x20, 0x23, 0x45, 0x30, 0x45, 0x30, 0x45, 0x30, 0x3b,
-  0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x62, 0x6f, 0x74,
-  0x74, 0x6f, 0x6d, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 0x6e, 0x6f, 0x6e,
-  0x65, 0x20, 0x23, 0x45, 0x30, 0x45, 0x30, 0x45, 0x30, 0x3b, 0x0a, 0x09,
-  0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a,
-  0x20, 0x31, 0x70, 0x78, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x20, 0x23, 0x45,
-  0x30, 0x45, 0x30, 0x45, 0x30, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x72, 0x67,
-  0x69, 0x6e, 0x3a, 0x20, 0x30, 0x70, 0x78, 0x3b, 0x0a, 0x7d, 0x0a, 0x2e,
-  0x6d, 0x64, 0x65, 0x73, 0x63, 0x52, 0x69, 0x67, 0x68, 0x74, 0x20, 0x7b,
-  0x0a, 0x09, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a,
-  0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x65, 0x72, 0x3b, 0x0a, 0x09, 0x66,
-  0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x20,
-  0x41, 0x72, 0x69, 0x61, 0x6c, 0x2c, 0x20, 0x48, 0x65, 0x6c, 0x76, 0x65,
-  0x74, 0x69, 0x63, 0x61, 0x2c, 0x20, 0x73, 0x61, 0x6e, 0x73, 0x2d, 0x73,
-  0x65, 0x72, 0x69, 0x66, 0x3b, 0x0a, 0x09, 0x66, 0x6f, 0x6e, 0x74, 0x2d,
-  0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x20, 0x69, 0x74, 0x61, 0x6c, 0x69,
-  0x63, 0x3b, 0x0a, 0x09, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75,
-  0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x46,
-  0x41, 0x46, 0x41, 0x46, 0x41, 0x3b, 0x0a, 0x09, 0x70, 0x61, 0x64, 0x64,
-  0x69, 0x6e, 0x67, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x20, 0x34, 0x70,
-  0x78, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x74,
-  0x6f, 0x70, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 0x6e, 0x6f, 0x6e, 0x65,
-  0x20, 0x23, 0x45, 0x30, 0x45, 0x30, 0x45, 0x30, 0x3b, 0x0a, 0x09, 0x62,
-  0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a,
-  0x20, 0x31, 0x70, 0x78, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x20, 0x23, 0x45,
-  0x30, 0x45, 0x30, 0x45, 0x30, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64,
-  0x65, 0x72, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x20, 0x31,
+  0x74, 0x2c, 0x20, 0x2e, 0x67, 0x20, 0x7b, 0x0a, 0x09, 0x66, 0x6f, 0x6e,
+  0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x73, 0x6d, 0x61, 0x6c,
+  0x6c, 0x65, 0x72, 0x3b, 0x0a, 0x09, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66,
+  0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x20, 0x41, 0x72, 0x69, 0x61, 0x6c,
+  0x2c, 0x20, 0x48, 0x65, 0x6c, 0x76, 0x65, 0x74, 0x69, 0x63, 0x61, 0x2c,
+  0x20, 0x73, 0x61, 0x6e, 0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3b,
+  0x0a, 0x09, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64,
+  0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x46, 0x41, 0x46,
+  0x41, 0x46, 0x41, 0x3b, 0x0a, 0x09, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e,
+  0x67, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x20, 0x38, 0x70, 0x78, 0x3b,
+  0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x74, 0x6f, 0x70,
+  0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x20, 0x23,
+  0x45, 0x30, 0x45, 0x30, 0x45, 0x30, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72,
+  0x64, 0x65, 0x72, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x31,
   0x70, 0x78, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x20, 0x23, 0x45, 0x30, 0x45,
   0x30, 0x45, 0x30, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72,
-  0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 0x6e,
-  0x6f, 0x6e, 0x65, 0x20, 0x23, 0x45, 0x30, 0x45, 0x30, 0x45, 0x30, 0x3b,
-  0x0a, 0x09, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x30, 0x70,
-  0x78, 0x3b, 0x0a, 0x09, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x2d,
-  0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x20, 0x30, 0x70, 0x78, 0x3b,
-  0x0a, 0x09, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x2d, 0x72, 0x69,
-  0x67, 0x68, 0x74, 0x3a, 0x20, 0x38, 0x70, 0x78, 0x3b, 0x0a, 0x7d, 0x0a,
-  0x2e, 0x6d, 0x65, 0x6d, 0x49, 0x74, 0x65, 0x6d, 0x4c, 0x65, 0x66, 0x74,
-  0x20, 0x7b, 0x0a, 0x09, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a,
-  0x20, 0x31, 0x70, 0x78, 0x20, 0x30, 0x70, 0x78, 0x20, 0x30, 0x70, 0x78,
-  0x20, 0x38, 0x70, 0x78, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x72, 0x67, 0x69,
-  0x6e, 0x3a, 0x20, 0x34, 0x70, 0x78, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72,
-  0x64, 0x65, 0x72, 0x2d, 0x74, 0x6f, 0x70, 0x2d, 0x77, 0x69, 0x64, 0x74,
-  0x68, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72,
-  0x64, 0x65, 0x72, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2d, 0x77, 0x69,
-  0x64, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x3b, 0x0a, 0x09, 0x62,
-  0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d,
-  0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x3b,
-  0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x6c, 0x65, 0x66,
-  0x74, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x70, 0x78,
+  0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x20, 0x31, 0x70, 0x78,
+  0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x20, 0x23, 0x45, 0x30, 0x45, 0x30, 0x45,
+  0x30, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x6c,
+  0x65, 0x66, 0x74, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 0x6e, 0x6f, 0x6e,
+  0x65, 0x20, 0x23, 0x45, 0x30, 0x45, 0x30, 0x45, 0x30, 0x3b, 0x0a, 0x09,
+  0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x30, 0x70, 0x78, 0x3b,
+  0x0a, 0x7d, 0x0a, 0x2e, 0x6d, 0x64, 0x65, 0x73, 0x63, 0x52, 0x69, 0x67,
+  0x68, 0x74, 0x2c, 0x20, 0x2e, 0x6d, 0x20, 0x74, 0x64, 0x20, 0x7b, 0x0a,
+  0x09, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20,
+  0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x65, 0x72, 0x3b, 0x0a, 0x09, 0x66, 0x6f,
+  0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x20, 0x41,
+  0x72, 0x69, 0x61, 0x6c, 0x2c, 0x20, 0x48, 0x65, 0x6c, 0x76, 0x65, 0x74,
+  0x69, 0x63, 0x61, 0x2c, 0x20, 0x73, 0x61, 0x6e, 0x73, 0x2d, 0x73, 0x65,
+  0x72, 0x69, 0x66, 0x3b, 0x0a, 0x09, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73,
+  0x74, 0x79, 0x6c, 0x65, 0x3a, 0x20, 0x69, 0x74, 0x61, 0x6c, 0x69, 0x63,
+  0x3b, 0x0a, 0x09, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e,
+  0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x46, 0x41,
+  0x46, 0x41, 0x46, 0x41, 0x3b, 0x0a, 0x09, 0x70, 0x61, 0x64, 0x64, 0x69,
+  0x6e, 0x67, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x20, 0x34, 0x70, 0x78,
   0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x74, 0x6f,
-  0x70, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x20, 0x73, 0x6f, 0x6c,
-  0x69, 0x64, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d,
-  0x74, 0x6f, 0x70, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23,
-  0x45, 0x30, 0x45, 0x30, 0x45, 0x30, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72,
-  0x64, 0x65, 0x72, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2d, 0x63, 0x6f,
-  0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x45, 0x30, 0x45, 0x30, 0x45, 0x30,
-  0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x62, 0x6f,
-  0x74, 0x74, 0x6f, 0x6d, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20,
+  0x70, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x20,
   0x23, 0x45, 0x30, 0x45, 0x30, 0x45, 0x30, 0x3b, 0x0a, 0x09, 0x62, 0x6f,
-  0x72, 0x64, 0x65, 0x72, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x2d, 0x63, 0x6f,
-  0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x45, 0x30, 0x45, 0x30, 0x45, 0x30,
-  0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x69,
-  0x67, 0x68, 0x74, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x20, 0x6e,
-  0x6f, 0x6e, 0x65, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72,
-  0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x2d, 0x73, 0x74, 0x79, 0x6c,
-  0x65, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x0a, 0x09, 0x62, 0x6f,
-  0x72, 0x64, 0x65, 0x72, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x2d, 0x73, 0x74,
-  0x79, 0x6c, 0x65, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x0a, 0x09,
-  0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63,
-  0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x46, 0x41, 0x46, 0x41, 0x46,
-  0x41, 0x3b, 0x0a, 0x09, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d,
-  0x69, 0x6c, 0x79, 0x3a, 0x20, 0x47, 0x65, 0x6e, 0x65, 0x76, 0x61, 0x2c,
-  0x20, 0x41, 0x72, 0x69, 0x61, 0x6c, 0x2c, 0x20, 0x48, 0x65, 0x6c, 0x76,
-  0x65, 0x74, 0x69, 0x63, 0x61, 0x2c, 0x20, 0x73, 0x61, 0x6e, 0x73, 0x2d,
-  0x73, 0x65, 0x72, 0x69, 0x66, 0x3b, 0x0a, 0x09, 0x66, 0x6f, 0x6e, 0x74,
-  0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x31, 0x32, 0x70, 0x78, 0x3b,
-  0x0a, 0x7d, 0x0a, 0x2e, 0x6d, 0x65, 0x6d, 0x49, 0x74, 0x65, 0x6d, 0x52,
-  0x69, 0x67, 0x68, 0x74, 0x20, 0x7b, 0x0a, 0x09, 0x70, 0x61, 0x64, 0x64,
-  0x69, 0x6e, 0x67, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 0x30, 0x70, 0x78,
-  0x20, 0x30, 0x70, 0x78, 0x20, 0x38, 0x70, 0x78, 0x3b, 0x0a, 0x09, 0x6d,
-  0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x34, 0x70, 0x78, 0x3b, 0x0a,
-  0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x74, 0x6f, 0x70, 0x2d,
-  0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x3b, 0x0a,
-  0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x69, 0x67, 0x68,
-  0x74, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x70, 0x78,
-  0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x62, 0x6f,
-  0x74, 0x74, 0x6f, 0x6d, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20,
+  0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20,
+  0x31, 0x70, 0x78, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x20, 0x23, 0x45, 0x30,
+  0x45, 0x30, 0x45, 0x30, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65,
+  0x72, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x20, 0x31, 0x70,
+  0x78, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x20, 0x23, 0x45, 0x30, 0x45, 0x30,
+  0x45, 0x30, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d,
+  0x6c, 0x65, 0x66, 0x74, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 0x6e, 0x6f,
+  0x6e, 0x65, 0x20, 0x23, 0x45, 0x30, 0x45, 0x30, 0x45, 0x30, 0x3b, 0x0a,
+  0x09, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x30, 0x70, 0x78,
+  0x3b, 0x0a, 0x09, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x2d, 0x62,
+  0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x20, 0x30, 0x70, 0x78, 0x3b, 0x0a,
+  0x09, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x2d, 0x72, 0x69, 0x67,
+  0x68, 0x74, 0x3a, 0x20, 0x38, 0x70, 0x78, 0x3b, 0x0a, 0x7d, 0x0a, 0x2e,
+  0x6d, 0x65, 0x6d, 0x49, 0x74, 0x65, 0x6d, 0x4c, 0x65, 0x66, 0x74, 0x2c,
+  0x20, 0x2e, 0x6c, 0x20, 0x7b, 0x0a, 0x09, 0x70, 0x61, 0x64, 0x64, 0x69,
+  0x6e, 0x67, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 0x30, 0x70, 0x78, 0x20,
+  0x30, 0x70, 0x78, 0x20, 0x38, 0x70, 0x78, 0x3b, 0x0a, 0x09, 0x6d, 0x61,
+  0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x34, 0x70, 0x78, 0x3b, 0x0a, 0x09,
+  0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x74, 0x6f, 0x70, 0x2d, 0x77,
+  0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x3b, 0x0a, 0x09,
+  0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74,
+  0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x3b,
+  0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x62, 0x6f, 0x74,
+  0x74, 0x6f, 0x6d, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x31,
+  0x70, 0x78, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d,
+  0x6c, 0x65, 0x66, 0x74, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20,
   0x31, 0x70, 0x78, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72,
-  0x2d, 0x6c, 0x65, 0x66, 0x74, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a,
-  0x20, 0x31, 0x70, 0x78, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65,
-  0x72, 0x2d, 0x74, 0x6f, 0x70, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a,
-  0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72,
-  0x64, 0x65, 0x72, 0x2d, 0x74, 0x6f, 0x70, 0x2d, 0x63, 0x6f, 0x6c, 0x6f,
+  0x2d, 0x74, 0x6f, 0x70, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x20,
+  0x73, 0x6f, 0x6c, 0x69, 0x64, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64,
+  0x65, 0x72, 0x2d, 0x74, 0x6f, 0x70, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+  0x3a, 0x20, 0x23, 0x45, 0x30, 0x45, 0x30, 0x45, 0x30, 0x3b, 0x0a, 0x09,
+  0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74,
+  0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x45, 0x30, 0x45,
+  0x30, 0x45, 0x30, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72,
+  0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x2d, 0x63, 0x6f, 0x6c, 0x6f,
   0x72, 0x3a, 0x20, 0x23, 0x45, 0x30, 0x45, 0x30, 0x45, 0x30, 0x3b, 0x0a,
-  0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x69, 0x67, 0x68,
-  0x74, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x45, 0x30,
-  0x45, 0x30, 0x45, 0x30, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65,
-  0x72, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x2d, 0x63, 0x6f, 0x6c,
-  0x6f, 0x72, 0x3a, 0x20, 0x23, 0x45, 0x30, 0x45, 0x30, 0x45, 0x30, 0x3b,
-  0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x6c, 0x65, 0x66,
-  0x74, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x45, 0x30,
-  0x45, 0x30, 0x45, 0x30, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65,
-  0x72, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2d, 0x73, 0x74, 0x79, 0x6c,
-  0x65, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x0a, 0x09, 0x62, 0x6f,
+  0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x6c, 0x65, 0x66, 0x74,
+  0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x45, 0x30, 0x45,
+  0x30, 0x45, 0x30, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72,
+  0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65,
+  0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72,
+  0x64, 0x65, 0x72, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x2d, 0x73,
+  0x74, 0x79, 0x6c, 0x65, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x0a,
+  0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x6c, 0x65, 0x66, 0x74,
+  0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65,
+  0x3b, 0x0a, 0x09, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e,
+  0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x46, 0x41,
+  0x46, 0x41, 0x46, 0x41, 0x3b, 0x0a, 0x09, 0x66, 0x6f, 0x6e, 0x74, 0x2d,
+  0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x20, 0x47, 0x65, 0x6e, 0x65,
+  0x76, 0x61, 0x2c, 0x20, 0x41, 0x72, 0x69, 0x61, 0x6c, 0x2c, 0x20, 0x48,
+  0x65, 0x6c, 0x76, 0x65, 0x74, 0x69, 0x63, 0x61, 0x2c, 0x20, 0x73, 0x61,
+  0x6e, 0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3b, 0x0a, 0x09, 0x66,
+  0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x31, 0x32,
+  0x70, 0x78, 0x3b, 0x0a, 0x7d, 0x0a, 0x2e, 0x6d, 0x65, 0x6d, 0x49, 0x74,
+  0x65, 0x6d, 0x52, 0x69, 0x67, 0x68, 0x74, 0x2c, 0x20, 0x2e, 0x72, 0x20,
+  0x7b, 0x0a, 0x09, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20,
+  0x31, 0x70, 0x78, 0x20, 0x30, 0x70, 0x78, 0x20, 0x30, 0x70, 0x78, 0x20,
+  0x38, 0x70, 0x78, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e,
+  0x3a, 0x20, 0x34, 0x70, 0x78, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64,
+  0x65, 0x72, 0x2d, 0x74, 0x6f, 0x70, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68,
+  0x3a, 0x20, 0x31, 0x70, 0x78, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64,
+  0x65, 0x72, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2d, 0x77, 0x69, 0x64,
+  0x74, 0x68, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x3b, 0x0a, 0x09, 0x62, 0x6f,
   0x72, 0x64, 0x65, 0x72, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x2d,
-  0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b,
-  0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x6c, 0x65, 0x66,
-  0x74, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x20, 0x6e, 0x6f, 0x6e,
-  0x65, 0x3b, 0x0a, 0x09, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75,
-  0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x46,
-  0x41, 0x46, 0x41, 0x46, 0x41, 0x3b, 0x0a, 0x09, 0x66, 0x6f, 0x6e, 0x74,
-  0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x20, 0x47, 0x65, 0x6e,
-  0x65, 0x76, 0x61, 0x2c, 0x20, 0x41, 0x72, 0x69, 0x61, 0x6c, 0x2c, 0x20,
-  0x48, 0x65, 0x6c, 0x76, 0x65, 0x74, 0x69, 0x63, 0x61, 0x2c, 0x20, 0x73,
-  0x61, 0x6e, 0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3b, 0x0a, 0x09,
-  0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x31,
-  0x33, 0x70, 0x78, 0x3b, 0x0a, 0x7d, 0x0a, 0x2e, 0x73, 0x65, 0x61, 0x72,
-  0x63, 0x68, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x20, 0x63, 0x6f, 0x6c,
-  0x6f, 0x72, 0x3a, 0x20, 0x23, 0x30, 0x30, 0x30, 0x30, 0x65, 0x65, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67,
-  0x68, 0x74, 0x3a, 0x20, 0x62, 0x6f, 0x6c, 0x64, 0x3b, 0x0a, 0x7d, 0x0a,
-  0x46, 0x4f, 0x52, 0x4d, 0x2e, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20,
-  0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62,
-  0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x20, 0x30, 0x70, 0x78, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x70,
-  0x3a, 0x20, 0x30, 0x70, 0x78, 0x3b, 0x0a, 0x7d, 0x0a, 0x49, 0x4e, 0x50,
-  0x55, 0x54, 0x2e, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x7b, 0x20,
-  0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x37,
-  0x35, 0x25, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
-  0x3a, 0x20, 0x23, 0x30, 0x30, 0x30, 0x30, 0x38, 0x30, 0x3b, 0x0a, 0x20,
+  0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x3b, 0x0a,
+  0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x6c, 0x65, 0x66, 0x74,
+  0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x3b,
+  0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x74, 0x6f, 0x70,
+  0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x20, 0x73, 0x6f, 0x6c, 0x69,
+  0x64, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x74,
+  0x6f, 0x70, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x45,
+  0x30, 0x45, 0x30, 0x45, 0x30, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64,
+  0x65, 0x72, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2d, 0x63, 0x6f, 0x6c,
+  0x6f, 0x72, 0x3a, 0x20, 0x23, 0x45, 0x30, 0x45, 0x30, 0x45, 0x30, 0x3b,
+  0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x62, 0x6f, 0x74,
+  0x74, 0x6f, 0x6d, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23,
+  0x45, 0x30, 0x45, 0x30, 0x45, 0x30, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72,
+  0x64, 0x65, 0x72, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x2d, 0x63, 0x6f, 0x6c,
+  0x6f, 0x72, 0x3a, 0x20, 0x23, 0x45, 0x30, 0x45, 0x30, 0x45, 0x30, 0x3b,
+  0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x69, 0x67,
+  0x68, 0x74, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x20, 0x6e, 0x6f,
+  0x6e, 0x65, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d,
+  0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65,
+  0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72,
+  0x64, 0x65, 0x72, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x2d, 0x73, 0x74, 0x79,
+  0x6c, 0x65, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x0a, 0x09, 0x62,
+  0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f,
+  0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x46, 0x41, 0x46, 0x41, 0x46, 0x41,
+  0x3b, 0x0a, 0x09, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69,
+  0x6c, 0x79, 0x3a, 0x20, 0x47, 0x65, 0x6e, 0x65, 0x76, 0x61, 0x2c, 0x20,
+  0x41, 0x72, 0x69, 0x61, 0x6c, 0x2c, 0x20, 0x48, 0x65, 0x6c, 0x76, 0x65,
+  0x74, 0x69, 0x63, 0x61, 0x2c, 0x20, 0x73, 0x61, 0x6e, 0x73, 0x2d, 0x73,
+  0x65, 0x72, 0x69, 0x66, 0x3b, 0x0a, 0x09, 0x66, 0x6f, 0x6e, 0x74, 0x2d,
+  0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x31, 0x33, 0x70, 0x78, 0x3b, 0x0a,
+  0x7d, 0x0a, 0x2f, 0x2a, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
+  0x74, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76,
+  0x65, 0x72, 0x62, 0x6f, 0x73, 0x65, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x75,
+  0x70, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x68,
+  0x6f, 0x72, 0x74, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x65, 0x73, 0x20,
+  0x6f, 0x66, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x63, 0x74, 0x4d, 0x61,
+  0x72, 0x6b, 0x75, 0x70, 0x20, 0x2a, 0x2f, 0x0a, 0x2e, 0x6c, 0x20, 0x7b,
+  0x0a, 0x09, 0x77, 0x68, 0x69, 0x74, 0x65, 0x2d, 0x73, 0x70, 0x61, 0x63,
+  0x65, 0x3a, 0x20, 0x6e, 0x6f, 0x77, 0x72, 0x61, 0x70, 0x3b, 0x0a, 0x09,
+  0x74, 0x65, 0x78, 0x74, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a, 0x20,
+  0x72, 0x69, 0x67, 0x68, 0x74, 0x3b, 0x0a, 0x09, 0x76, 0x65, 0x72, 0x74,
+  0x69, 0x63, 0x61, 0x6c, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a, 0x20,
+  0x74, 0x6f, 0x70, 0x3b, 0x0a, 0x7d, 0x0a, 0x2e, 0x72, 0x20, 0x7b, 0x0a,
+  0x09, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x2d, 0x61, 0x6c,
+  0x69, 0x67, 0x6e, 0x3a, 0x20, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3b,
+  0x0a, 0x7d, 0x0a, 0x2e, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x7b, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20,
+  0x23, 0x30, 0x30, 0x30, 0x30, 0x65, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66,
+  0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20,
+  0x62, 0x6f, 0x6c, 0x64, 0x3b, 0x0a, 0x7d, 0x0a, 0x46, 0x4f, 0x52, 0x4d,
+  0x2e, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x7b, 0x0a, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68,
-  0x74, 0x3a, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x3b, 0x0a, 0x20,
+  0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f,
+  0x6d, 0x3a, 0x20, 0x30, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61,
+  0x72, 0x67, 0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x20, 0x30, 0x70,
+  0x78, 0x3b, 0x0a, 0x7d, 0x0a, 0x49, 0x4e, 0x50, 0x55, 0x54, 0x2e, 0x73,
+  0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x7b, 0x20, 0x66, 0x6f, 0x6e, 0x74,
+  0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x37, 0x35, 0x25, 0x3b, 0x0a,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64,
-  0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x65, 0x65, 0x65,
-  0x65, 0x66, 0x66, 0x3b, 0x0a, 0x7d, 0x0a, 0x54, 0x44, 0x2e, 0x74, 0x69,
-  0x6e, 0x79, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x20, 0x66, 0x6f,
-  0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x37, 0x35, 0x25,
-  0x3b, 0x0a, 0x7d, 0x0a, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x74,
-  0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x63, 0x73,
-  0x73, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x75, 0x6c, 0x2e, 0x4c, 0x69, 0x6e,
-  0x6b, 0x65, 0x64, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x7b, 0x20, 0x64, 0x69,
-  0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b,
-  0x3b, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x75, 0x6c, 0x2e, 0x4c, 0x69, 0x6e,
-  0x6b, 0x65, 0x64, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x75, 0x6c, 0x20, 0x7b,
-  0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 0x6e, 0x6f,
-  0x6e, 0x65, 0x3b, 0x20, 0x7d, 0x20, 0x0a, 0x20, 0x20, 0x2e, 0x48, 0x61,
-  0x6e, 0x64, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x53, 0x74, 0x79, 0x6c,
-  0x65, 0x20, 0x7b, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x3a, 0x20,
-  0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x20, 0x63, 0x75, 0x72,
-  0x73, 0x6f, 0x72, 0x3a, 0x20, 0x68, 0x61, 0x6e, 0x64, 0x3b, 0x20, 0x7d,
-  0x20, 0x20, 0x2f, 0x2a, 0x20, 0x46, 0x6f, 0x72, 0x20, 0x49, 0x45, 0x20,
-  0x2a, 0x2f, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3e, 0x0a
+  0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x30,
+  0x30, 0x30, 0x30, 0x38, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f,
+  0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x6e,
+  0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61,
+  0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c,
+  0x6f, 0x72, 0x3a, 0x20, 0x23, 0x65, 0x65, 0x65, 0x65, 0x66, 0x66, 0x3b,
+  0x0a, 0x7d, 0x0a, 0x54, 0x44, 0x2e, 0x74, 0x69, 0x6e, 0x79, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x7b, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73,
+  0x69, 0x7a, 0x65, 0x3a, 0x20, 0x37, 0x35, 0x25, 0x3b, 0x0a, 0x7d, 0x0a,
+  0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d,
+  0x22, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x63, 0x73, 0x73, 0x22, 0x3e, 0x0a,
+  0x20, 0x20, 0x75, 0x6c, 0x2e, 0x4c, 0x69, 0x6e, 0x6b, 0x65, 0x64, 0x4c,
+  0x69, 0x73, 0x74, 0x20, 0x7b, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61,
+  0x79, 0x3a, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x3b, 0x20, 0x7d, 0x0a,
+  0x20, 0x20, 0x75, 0x6c, 0x2e, 0x4c, 0x69, 0x6e, 0x6b, 0x65, 0x64, 0x4c,
+  0x69, 0x73, 0x74, 0x20, 0x75, 0x6c, 0x20, 0x7b, 0x20, 0x64, 0x69, 0x73,
+  0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x20,
+  0x7d, 0x20, 0x0a, 0x20, 0x20, 0x2e, 0x48, 0x61, 0x6e, 0x64, 0x43, 0x75,
+  0x72, 0x73, 0x6f, 0x72, 0x53, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x7b, 0x20,
+  0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x3a, 0x20, 0x70, 0x6f, 0x69, 0x6e,
+  0x74, 0x65, 0x72, 0x3b, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x3a,
+  0x20, 0x68, 0x61, 0x6e, 0x64, 0x3b, 0x20, 0x7d, 0x20, 0x20, 0x2f, 0x2a,
+  0x20, 0x46, 0x6f, 0x72, 0x20, 0x49, 0x45, 0x20, 0x2a, 0x2f, 0x0a, 0x3c,
+  0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3e, 0x0a
 };
-unsigned int ugdocu_css_len = 5004;
+unsigned int ugdocu_css_len = 5204;
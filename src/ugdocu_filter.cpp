@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2013-2016:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "common/log.h"
+#include "common/error.h"
+#include "common/util/string_util.h"
+#include "registry/class_helper.h"
+
+#include "ugdocu_filter.h"
+
+using namespace std;
+
+namespace ug
+{
+namespace DocuGen
+{
+
+using namespace bridge;
+
+bool MatchesWildcard(const string &pattern, const string &str)
+{
+	// iterative matching, backtracking only to the last '*'
+	size_t p = 0, s = 0, star = string::npos, starMatch = 0;
+	while(s < str.size())
+	{
+		if(p < pattern.size() && (pattern[p] == '?' || pattern[p] == str[s]))
+		{
+			p++; s++;
+		}
+		else if(p < pattern.size() && pattern[p] == '*')
+		{
+			star = p++;
+			starMatch = s;
+		}
+		else if(star != string::npos)
+		{
+			p = star+1;
+			s = ++starMatch;
+		}
+		else
+			return false;
+	}
+	while(p < pattern.size() && pattern[p] == '*')
+		p++;
+	return p == pattern.size();
+}
+
+/// pattern matches the group or one of its subgroups
+static bool MatchesGroupPattern(const string &pattern, const string &group)
+{
+	return MatchesWildcard(pattern, group) || MatchesWildcard(pattern + "/*", group);
+}
+
+static void ParsePatterns(const string &str, vector<string> &patterns, const string &prefix)
+{
+	vector<string> tokens;
+	TokenizeString(str, tokens, ',');
+	for(size_t i=0; i<tokens.size(); i++)
+	{
+		string pattern = TrimString(tokens[i]);
+		if(!pattern.empty())
+			patterns.push_back(prefix + pattern);
+	}
+}
+
+DocuGenFilter::DocuGenFilter() :
+	  m_bActive( false )
+{}
+
+void DocuGenFilter::init(const string &include, const string &exclude, const string &plugins)
+{
+	try{
+	m_include.clear();
+	m_exclude.clear();
+	m_classes.clear();
+	m_classGroups.clear();
+	m_functions.clear();
+	m_pending.clear();
+
+	ParsePatterns(include, m_include, "");
+	// plugin groups are recognized by IsPluginGroup
+	ParsePatterns(plugins, m_include, "(Plugin) ");
+	ParsePatterns(exclude, m_exclude, "");
+	m_bActive = !m_include.empty() || !m_exclude.empty();
+	if(!m_bActive) return;
+
+	Registry &reg = GetUGRegistry();
+
+	// overloads of the selected groups and the classes they use, every
+	// overload has its own group and parameters
+	size_t numOverloads = 0;
+	for(size_t i=0; i<reg.num_functions(); i++)
+	{
+		ExportedFunctionGroup &fu = reg.get_function_group(i);
+		for(size_t j=0; j<fu.num_overloads(); j++, numOverloads++)
+		{
+			const ExportedFunction *f = fu.get_overload(j);
+			if(!group_selected(f->group())) continue;
+			m_functions.insert(f);
+			select_classes_in(f->params_in());
+			select_classes_in(f->params_out());
+		}
+	}
+	for(size_t i=0; i<reg.num_classes(); i++)
+		if(group_selected(reg.get_class(i).group()))
+			select_class(reg.get_class(i).name());
+
+	map<const IExportedClass*, const ClassGroupDesc*> classGroups;
+	for(size_t i=0; i<reg.num_class_groups(); i++)
+	{
+		const ClassGroupDesc *g = reg.get_class_group(i);
+		for(size_t j=0; j<g->num_classes(); j++)
+			classGroups[g->get_class(j)] = g;
+	}
+
+	// every selected class page links to classes in parameters and to its
+	// class group, which links to the default class. Their pages link on,
+	// so this continues until no new class is selected.
+	while(!m_pending.empty())
+	{
+		const IExportedClass *c = m_pending.back();
+		m_pending.pop_back();
+		select_linked_classes(c);
+		map<const IExportedClass*, const ClassGroupDesc*>::iterator it = classGroups.find(c);
+		if(it != classGroups.end() && m_classGroups.insert(it->second).second
+				&& it->second->get_default_class() != NULL)
+			select_class(it->second->get_default_class()->name());
+	}
+
+	UG_LOG("Filter selected " << m_classes.size() << " of " << reg.num_classes() << " classes, "
+			<< m_functions.size() << " of " << numOverloads << " functions.\n");
+	}UG_CATCH_THROW_FUNC();
+}
+
+void DocuGenFilter::select_class(const string &name)
+{
+	Registry &reg = GetUGRegistry();
+	const IExportedClass *c = reg.get_class(name);
+	if(c == NULL || !m_classes.insert(c).second) return;
+	m_pending.push_back(c);
+	const vector<const char*> *names = c->class_names();
+	if(names == NULL) return;
+	for(size_t i=0; i<names->size(); i++)
+		select_class(names->at(i));
+}
+
+void DocuGenFilter::select_linked_classes(const IExportedClass *c)
+{
+	for(size_t j=0; j<c->num_constructors(); j++)
+		select_classes_in(c->get_constructor(j).params_in());
+	for(size_t j=0; j<c->num_methods(); j++)
+	{
+		const ExportedMethodGroup &grp = c->get_method_group(j);
+		for(size_t k=0; k<grp.num_overloads(); k++)
+		{
+			select_classes_in(grp.get_overload(k)->params_in());
+			select_classes_in(grp.get_overload(k)->params_out());
+		}
+	}
+	for(size_t j=0; j<c->num_const_methods(); j++)
+	{
+		const ExportedMethodGroup &grp = c->get_const_method_group(j);
+		for(size_t k=0; k<grp.num_overloads(); k++)
+		{
+			select_classes_in(grp.get_overload(k)->params_in());
+			select_classes_in(grp.get_overload(k)->params_out());
+		}
+	}
+}
+
+void DocuGenFilter::select_classes_in(const ParameterInfo &par)
+{
+	for(size_t i=0; i<(size_t)par.size(); i++)
+		if(par.class_name(i) != NULL)
+			select_class(par.class_name(i));
+}
+
+bool DocuGenFilter::group_selected(const string &group) const
+{
+	if(!m_bActive) return true;
+	bool bIncluded = m_include.empty();
+	for(size_t i=0; i<m_include.size() && !bIncluded; i++)
+		bIncluded = MatchesGroupPattern(m_include[i], group);
+	if(!bIncluded) return false;
+	for(size_t i=0; i<m_exclude.size(); i++)
+		if(MatchesGroupPattern(m_exclude[i], group))
+			return false;
+	return true;
+}
+
+bool DocuGenFilter::class_selected(const IExportedClass *c) const
+{
+	return !m_bActive || m_classes.count(c) > 0;
+}
+
+bool DocuGenFilter::class_group_selected(const ClassGroupDesc *g) const
+{
+	return !m_bActive || m_classGroups.count(g) > 0;
+}
+
+bool DocuGenFilter::function_selected(const ExportedFunction *f) const
+{
+	return !m_bActive || m_functions.count(f) > 0;
+}
+
+bool DocuGenFilter::description_selected(const UGDocuClassDescription &d) const
+{
+	if(d.mp_class != NULL) return class_selected(d.mp_class);
+	if(d.mp_group != NULL) return class_group_selected(d.mp_group);
+	return !m_bActive;
+}
+
+DocuGenFilter &GetDocuGenFilter()
+{
+	static DocuGenFilter filter;
+	return filter;
+}
+
+}	// namespace DocuGen
+}	// namespace ug
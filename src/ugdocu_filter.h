@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2013-2016:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __UG__UGDOCU_FILTER_H__
+#define __UG__UGDOCU_FILTER_H__
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "bridge/bridge.h"
+#include "ug_docu_class_description.h"
+
+namespace ug
+{
+namespace DocuGen
+{
+
+/// \addtogroup apps_ugdocu
+/// \{
+
+/// matches str against pattern with the wildcards '*' (any sequence) and '?' (any character)
+bool MatchesWildcard(const std::string &pattern, const std::string &str);
+
+/**
+ * \brief Restricts the generation to some registry groups
+ * \details A group is selected if it matches one of the include patterns (or
+ *   there are none) and none of the exclude patterns. A pattern matches a
+ *   group and all its subgroups, e.g. "ug4/Grid" also selects "ug4/Grid/Refinement".
+ *
+ *   Selected are the classes and functions of the selected groups. To keep
+ *   the links of their pages valid, also selected are the base classes of
+ *   selected classes, all classes used in parameters of selected
+ *   constructors, methods and functions, the class groups of selected
+ *   classes and their default classes, repeated until nothing new is
+ *   selected.
+ *
+ *   Without patterns, everything is selected.
+ */
+class DocuGenFilter
+{
+public:
+	DocuGenFilter();
+
+	/// include and exclude are ','-separated patterns, plugins is a ','-separated list of plugin names
+	void init(const std::string &include, const std::string &exclude, const std::string &plugins);
+
+	bool is_active() const { return m_bActive; }
+
+	bool group_selected(const std::string &group) const;
+	bool class_selected(const bridge::IExportedClass *c) const;
+	bool class_group_selected(const bridge::ClassGroupDesc *g) const;
+	bool function_selected(const bridge::ExportedFunction *f) const;
+	/// class or class group of a description
+	bool description_selected(const UGDocuClassDescription &d) const;
+
+	size_t num_selected_classes() const { return m_classes.size(); }
+
+private:
+	void select_class(const std::string &name);
+	void select_classes_in(const bridge::ParameterInfo &par);
+	/// classes in parameters of the constructors and methods of c
+	void select_linked_classes(const bridge::IExportedClass *c);
+
+	bool m_bActive;
+	std::vector<std::string> m_include;
+	std::vector<std::string> m_exclude;
+	std::set<const bridge::IExportedClass*> m_classes;
+	std::set<const bridge::ClassGroupDesc*> m_classGroups;
+	std::set<const bridge::ExportedFunction*> m_functions;
+	/// selected classes whose links are not followed yet
+	std::vector<const bridge::IExportedClass*> m_pending;
+};
+
+/// the filter of the current generation, set up by GenerateScriptReferenceDocu
+DocuGenFilter &GetDocuGenFilter();
+
+// end group apps_ugdocu
+/// \}
+
+}	// namespace DocuGen
+}	// namespace ug
+
+#endif /* __UG__UGDOCU_FILTER_H__ */
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2013-2016:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <algorithm>
+#include <mutex>
+#include <string>
+
+#include "common/log.h"
+
+#include "ugdocu_log.h"
+
+using namespace std;
+
+namespace ug
+{
+namespace DocuGen
+{
+
+LogLevel currentLogLevel = LL_PROGRESS;
+
+static std::mutex logMutex;
+
+void SetLogLevel(LogLevel level)
+{
+	currentLogLevel = level;
+}
+
+void ParseLogLevel(const string &str, LogLevel &level)
+{
+	if(str == "quiet") level = LL_QUIET;
+	else if(str == "progress") level = LL_PROGRESS;
+	else if(str == "verbose") level = LL_VERBOSE;
+	else if(str == "trace") level = LL_TRACE;
+	else UG_WARNING("DocuGen: unknown log level '" << str << "', use quiet, progress, verbose or trace.\n");
+}
+
+void WriteDocuGenLog(const string &msg)
+{
+	std::lock_guard<std::mutex> lock(logMutex);
+	UG_LOG(msg);
+}
+
+void WriteDocuGenWarning(const string &msg)
+{
+	std::lock_guard<std::mutex> lock(logMutex);
+	UG_WARNING(msg);
+}
+
+ProgressCounter::ProgressCounter(const char *phase, size_t total) :
+	m_phase(phase), m_total(total), m_done(0), m_next(0),
+	m_bEnabled(currentLogLevel == LL_PROGRESS && total > 0)
+{}
+
+ProgressCounter::~ProgressCounter()
+{
+	if(m_bEnabled)
+	{
+		std::lock_guard<std::mutex> lock(logMutex);
+		UG_LOG("\r" << m_phase << ": " << m_done << "/" << m_total << "\n");
+	}
+}
+
+void ProgressCounter::print(size_t done)
+{
+	std::lock_guard<std::mutex> lock(logMutex);
+	if(done < m_next) return;
+	m_next = done + max((size_t) 1, m_total / 100);
+	UG_LOG("\r" << m_phase << ": " << done << "/" << m_total << flush);
+}
+
+}	// namespace DocuGen
+}	// namespace ug
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2013-2016:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __UG__UGDOCU_LOG_H__
+#define __UG__UGDOCU_LOG_H__
+
+#include <atomic>
+#include <sstream>
+#include <string>
+
+namespace ug
+{
+namespace DocuGen
+{
+
+/// \addtogroup apps_ugdocu
+/// \{
+
+enum LogLevel
+{
+	LL_QUIET = 0,	///< only warnings and errors
+	LL_PROGRESS,	///< one line per phase and an updating counter for long phases
+	LL_VERBOSE,		///< one line per written file
+	LL_TRACE		///< one line per registered class and function
+};
+
+/// current level, only to be read through DOCUGEN_LOG and IsLogLevelEnabled
+extern LogLevel currentLogLevel;
+
+inline bool IsLogLevelEnabled(LogLevel level)
+{
+	return currentLogLevel >= level;
+}
+
+void SetLogLevel(LogLevel level);
+
+/// "quiet", "progress", "verbose" or "trace", other values keep level and warn
+void ParseLogLevel(const std::string &str, LogLevel &level);
+
+/// writes msg to UG_LOG, serialized between threads
+void WriteDocuGenLog(const std::string &msg);
+
+/// writes msg to UG_WARNING, serialized with WriteDocuGenLog
+void WriteDocuGenWarning(const std::string &msg);
+
+/**
+ * \brief Logs msg if level is enabled
+ * \details msg may be a stream expression like in UG_LOG. If the level is
+ *   disabled, the cost is one branch, msg is not formatted.
+ *   Can be used from ParallelFor workers.
+ */
+#define DOCUGEN_LOG(level, msg) \
+	do { if(ug::DocuGen::IsLogLevelEnabled(level)) { \
+		std::stringstream docuGenLogStream; docuGenLogStream << msg; \
+		ug::DocuGen::WriteDocuGenLog(docuGenLogStream.str()); } } while(0)
+
+/// UG_WARNING that can be used from ParallelFor workers, shown at every level
+#define DOCUGEN_WARNING(msg) \
+	do { std::stringstream docuGenLogStream; docuGenLogStream << msg; \
+		ug::DocuGen::WriteDocuGenWarning(docuGenLogStream.str()); } while(0)
+
+/**
+ * \brief Single updating line "phase: done/total" for loops over many entities
+ * \details Only shown at LL_PROGRESS, at LL_VERBOSE and above every entity has
+ *   its own line anyway. The line is refreshed at most 100 times. step() may
+ *   be called from any thread.
+ */
+class ProgressCounter
+{
+public:
+	ProgressCounter(const char *phase, size_t total);
+	~ProgressCounter();
+
+	void step()
+	{
+		size_t done = ++m_done;
+		if(m_bEnabled && done >= m_next) print(done);
+	}
+
+private:
+	void print(size_t done);
+
+	const char *m_phase;
+	size_t m_total;
+	std::atomic<size_t> m_done;
+	std::atomic<size_t> m_next;
+	bool m_bEnabled;
+};
+
+// end group apps_ugdocu
+/// \}
+
+}	// namespace DocuGen
+}	// namespace ug
+
+#endif /* __UG__UGDOCU_LOG_H__ */
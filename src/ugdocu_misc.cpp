@@ -32,8 +32,10 @@
 
 #include <iostream>
 #include <sstream>
+#include <iomanip>
 
 #include <string>
+#include <map>
 
 #include "ug.h"
 #include "ugbase.h"
@@ -42,6 +44,7 @@
 #include "bridge/bridge.h"
 #include "registry/class_helper.h"
 #include "ug_docu_class_description.h"
+#include "docugen_session.h"
 
 using namespace std;
 using namespace ug;
@@ -53,10 +56,6 @@ namespace ug
 namespace DocuGen
 {
 
-extern vector<UGDocuClassDescription> classes;
-extern vector<UGDocuClassDescription> classesAndGroups;
-extern vector<UGDocuClassDescription> classesAndGroupsAndImplementations;
-
 bool IsPluginGroup(string g)
 {
 	return StartsWith(g, "(Plugin) ");
@@ -98,6 +97,47 @@ string tohtmlstring(const string &str)
 	return str;
 }
 
+string JSONStringEscape(const string &str)
+{
+	stringstream ss;
+	for(size_t i=0; i<str.size(); i++)
+	{
+		char c = str[i];
+		switch(c)
+		{
+			case '"': ss << "\\\""; break;
+			case '\\': ss << "\\\\"; break;
+			case '\n': ss << "\\n"; break;
+			case '\r': ss << "\\r"; break;
+			case '\t': ss << "\\t"; break;
+			default:
+				if((unsigned char) c < 0x20)
+					ss << "\\u" << hex << setw(4) << setfill('0') << (int) c << dec;
+				else
+					ss << c;
+		}
+	}
+	return ss.str();
+}
+
+uint64_t ContentHash(const string &str)
+{
+	uint64_t hash = 14695981039346656037ULL;
+	for(size_t i=0; i<str.size(); i++)
+	{
+		hash ^= (unsigned char) str[i];
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+string ContentHashToString(uint64_t hash)
+{
+	stringstream ss;
+	ss << hex << setw(16) << setfill('0') << hash;
+	return ss.str();
+}
+
 
 string GetClassGroup(string classname)
 {
@@ -106,7 +146,7 @@ string GetClassGroup(string classname)
 	if(c == NULL) return classname;
 	else
 	{
-		UGDocuClassDescription *d=GetUGDocuClassDescription(classes, c);
+		UGDocuClassDescription *d=GetUGDocuClassDescription(GetDocuGenSession().classes, c);
 		if(d == NULL || d->mp_group == NULL) return classname;
 		else return d->mp_group->name();
 	}
@@ -119,7 +159,7 @@ string GetClassGroupStd(string classname)
 	if(c == NULL) return classname;
 	else
 	{
-		UGDocuClassDescription *d=GetUGDocuClassDescription(classes, c);
+		UGDocuClassDescription *d=GetUGDocuClassDescription(GetDocuGenSession().classes, c);
 		if(d == NULL || d->mp_group == NULL || d->mp_group->get_default_class() == NULL) return classname;
 		else return d->mp_group->get_default_class()->name();
 	}
@@ -154,6 +194,42 @@ void WriteClassHierarchy(ostream &file, ClassHierarchy &c)
 
 
 
+static vector<string> configurations;
+static map<const IExportedClass*, vector<string> > defaultConfigurations;
+
+void ClearDefaultClasses()
+{
+	configurations.clear();
+	defaultConfigurations.clear();
+}
+
+void RecordDefaultClasses(const string &configuration)
+{
+	Registry &reg = GetUGRegistry();
+	configurations.push_back(configuration);
+	for(size_t i=0; i<reg.num_class_groups(); i++)
+	{
+		const IExportedClass *c = reg.get_class_group(i)->get_default_class();
+		if(c != NULL)
+			defaultConfigurations[c].push_back(configuration);
+	}
+}
+
+bool HasMultipleConfigurations()
+{
+	return configurations.size() > 1;
+}
+
+string GetDefaultConfigurations(const IExportedClass *c)
+{
+	map<const IExportedClass*, vector<string> >::const_iterator it = defaultConfigurations.find(c);
+	if(it == defaultConfigurations.end()) return "";
+	stringstream ss;
+	for(size_t i=0; i<it->second.size(); i++)
+		ss << (i > 0 ? ", " : "") << it->second[i];
+	return ss.str();
+}
+
 string GetBeautifiedTag(string tag)
 {
 	ReplaceAll(tag, ";", " ");
@@ -33,6 +33,7 @@
 #ifndef __UG__UGDOCU_MISC_H__
 #define __UG__UGDOCU_MISC_H__
 
+#include <stdint.h>
 #include "ug_docu_class_description.h"
 #include "registry/class_helper.h"
 
@@ -56,6 +57,35 @@ bool ExportedFunctionsGroupSort(const bridge::ExportedFunction * i,
 
 std::string tohtmlstring(const std::string &str);
 
+/// escapes quotes, backslashes and control characters for JSON strings
+std::string JSONStringEscape(const std::string &str);
+
+/// 64-bit FNV-1a hash, used to detect unchanged output files
+uint64_t ContentHash(const std::string &str);
+/// hash as 16 hex digits
+std::string ContentHashToString(uint64_t hash);
+
+std::string GetClassGroup(std::string classname);
+
+/// removes all elements which occur more than once, keeping the last occurrence
+template<typename T>
+void remove_doubles(std::vector<T> &v)
+{
+	std::vector<T> v2;
+	for(size_t i=0; i<v.size(); i++)
+	{
+		size_t j;
+		for(j=i+1; j<v.size(); j++)
+		{
+			if(j == i) continue;
+			if(v[i] == v[j]) break;
+		}
+		if(j == v.size())
+			v2.push_back(v[i]);
+	}
+	std::swap(v, v2);
+}
+
 void ParameterToString(std::ostream &file, const bridge::ParameterInfo &par, int i, bool bHTML);
 
 template<typename T>
@@ -98,11 +128,23 @@ static void WriteParametersOut(std::ostream &file, const T &thefunc, bool bHTML=
 
 void WriteClassHierarchy(std::ostream &file, bridge::ClassHierarchy &c);
 
+/// \{
+/// default classes of several dim/algebra configurations (option configs),
+/// RecordDefaultClasses is called after InitUG of each configuration
+void ClearDefaultClasses();
+void RecordDefaultClasses(const std::string &configuration);
+/// true if defaults of more than one configuration were recorded
+bool HasMultipleConfigurations();
+/// comma separated configurations in which c is the default class of its group
+std::string GetDefaultConfigurations(const bridge::IExportedClass *c);
+/// \}
+
 
+/// classes and functions of one registry group, the classes point into the session
 class UGRegistryGroup
 {
 public:
-	std::vector<UGDocuClassDescription> classesAndGroups;
+	std::vector<const UGDocuClassDescription*> classesAndGroups;
 	std::vector<bridge::ExportedFunction*> functions;
 };
 
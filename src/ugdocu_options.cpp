@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2013-2016:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common/log.h"
+#include "common/util/string_util.h"
+
+#include "ugdocu_options.h"
+
+using namespace std;
+
+namespace ug
+{
+namespace DocuGen
+{
+
+void ParseOptionString(const string &str, vector<pair<string, string> > &entries)
+{
+	vector<string> tokens;
+	TokenizeString(str, tokens, ';');
+	for(size_t i=0; i<tokens.size(); i++)
+	{
+		string key = TrimString(tokens[i]);
+		string value;
+		if(key.empty()) continue;
+
+		size_t eq = key.find('=');
+		if(eq != string::npos)
+		{
+			value = TrimString(key.substr(eq+1));
+			key = TrimString(key.substr(0, eq));
+		}
+		entries.push_back(make_pair(key, value));
+	}
+}
+
+bool OptionToBool(const string &key, const string &value, bool previous)
+{
+	if(value.empty() || value == "true" || value == "on" || value == "1")
+		return true;
+	if(value == "false" || value == "off" || value == "0")
+		return false;
+	UG_WARNING("DocuGen: option '" << key << "' expects a boolean, got '" << value
+				<< "', keeping " << (previous ? "true" : "false") << ".\n");
+	return previous;
+}
+
+size_t OptionToSize(const string &key, const string &value, size_t previous)
+{
+	size_t res = 0;
+	stringstream ss(value);
+	if(value.empty() || value[0] == '-' || !(ss >> res) || !ss.eof())
+	{
+		UG_WARNING("DocuGen: option '" << key << "' expects a number, got '" << value
+					<< "', keeping " << previous << ".\n");
+		return previous;
+	}
+	return res;
+}
+
+DocuGenOptions::DocuGenOptions() :
+	  completionShards( false )
+	, completionReferences( false )
+	, profile( false )
+	, trace( false )
+	, numThreads( 1 )
+	, completionDir( "" )
+	, logLevel( "" )
+	, configurations( "" )
+	, cache( true )
+	, includeGroups( "" )
+	, excludeGroups( "" )
+	, plugins( "" )
+	, indexShards( false )
+	, singlePage( false )
+	, compactMarkup( false )
+	, gzip( false )
+	, gzipMinSize( 1024 )
+	, sink( "files" )
+	, sinkFile( "" )
+	, serveCacheSize( 256 )
+{}
+
+void DocuGenOptions::parse(const string &str)
+{
+	vector<pair<string, string> > entries;
+	ParseOptionString(str, entries);
+	for(size_t i=0; i<entries.size(); i++)
+	{
+		const string &key = entries[i].first;
+		const string &value = entries[i].second;
+		if(key == "completionShards")
+			completionShards = OptionToBool(key, value, completionShards);
+		else if(key == "completionReferences")
+			completionReferences = OptionToBool(key, value, completionReferences);
+		else if(key == "profile")
+			profile = OptionToBool(key, value, profile);
+		else if(key == "trace")
+			trace = OptionToBool(key, value, trace);
+		else if(key == "threads")
+		{
+			numThreads = OptionToSize(key, value, numThreads);
+			if(numThreads > MAX_WORKER_THREADS)
+			{
+				UG_WARNING("DocuGen: threads=" << numThreads << " limited to " << MAX_WORKER_THREADS << ".\n");
+				numThreads = MAX_WORKER_THREADS;
+			}
+		}
+		else if(key == "completionDir")
+			completionDir = value;
+		else if(key == "log")
+			logLevel = value;
+		else if(key == "configs")
+			configurations = value;
+		else if(key == "cache")
+			cache = OptionToBool(key, value, cache);
+		else if(key == "include")
+			includeGroups = value;
+		else if(key == "exclude")
+			excludeGroups = value;
+		else if(key == "plugins")
+			plugins = value;
+		else if(key == "indexShards")
+			indexShards = OptionToBool(key, value, indexShards);
+		else if(key == "singlePage")
+			singlePage = OptionToBool(key, value, singlePage);
+		else if(key == "compactMarkup")
+			compactMarkup = OptionToBool(key, value, compactMarkup);
+		else if(key == "gzip")
+		{
+			gzip = OptionToBool(key, value, gzip);
+#ifndef UG_DOCUGEN_ZLIB
+			if(gzip)
+				UG_WARNING("DocuGen: built without zlib (cmake -DDOCUGEN_ZLIB=ON), option gzip ignored.\n");
+			gzip = false;
+#endif
+		}
+		else if(key == "gzipMinSize")
+			gzipMinSize = OptionToSize(key, value, gzipMinSize);
+		else if(key == "sink")
+			sink = value;
+		else if(key == "sinkFile")
+			sinkFile = value;
+		else if(key == "serveCacheSize")
+			serveCacheSize = OptionToSize(key, value, serveCacheSize);
+		else
+			UG_WARNING("DocuGen: unknown option '" << key << "' ignored.\n");
+	}
+}
+
+DocuGenOptions &GetDocuGenOptions()
+{
+	static DocuGenOptions options;
+	return options;
+}
+
+}	// namespace DocuGen
+}	// namespace ug
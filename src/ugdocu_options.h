@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2013-2016:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __UG__UGDOCU_OPTIONS_H__
+#define __UG__UGDOCU_OPTIONS_H__
+
+#include <string>
+#include <vector>
+#include <utility>
+
+namespace ug
+{
+namespace DocuGen
+{
+
+/// \addtogroup apps_ugdocu
+/// \{
+
+/// upper bound of the threads option, more threads only add contention on the output
+const size_t MAX_WORKER_THREADS = 256;
+
+/**
+ * \brief Additional settings of GenerateScriptReferenceDocu
+ * \details Options are given as one string of ';'-separated entries. Each
+ *   entry is either a flag (<tt>completionShards</tt>, same as
+ *   <tt>completionShards=true</tt>) or an assignment <tt>key=value</tt>.
+ *   Unknown keys are reported and ignored.
+ */
+class DocuGenOptions
+{
+public:
+	DocuGenOptions();
+
+	void parse(const std::string &str);
+
+	/// write one completion file per registry group/plugin plus a manifest
+	bool completionShards;
+	/// completion format version 2: classgroups and inherited members are
+	/// referenced by class name instead of being repeated
+	bool completionReferences;
+	/// write a per-phase timing/memory/io report (docugen_profile.json)
+	bool profile;
+	/// write spans of phases and single pages in Chrome trace-event format (docugen_trace.json)
+	bool trace;
+	/// number of worker threads for pages, C++ files and completion shards,
+	/// 0 means one per hardware thread, at most MAX_WORKER_THREADS
+	size_t numThreads;
+	/// directory of the completion list/shards, "" is ROOT_PATH/plugins/DocuGen
+	std::string completionDir;
+	/// quiet, progress, verbose or trace; "" is quiet if silent, progress otherwise
+	std::string logLevel;
+	/// ','-separated dim:ALGEBRA configurations like "2:CPU1,3:CPU3", "" is the default algebra
+	std::string configurations;
+	/// reuse class descriptions, rendered fragments and unchanged files of
+	/// earlier calls in this process (see DocuGenSession)
+	bool cache;
+	/// ','-separated patterns of registry groups to document (see DocuGenFilter), "" is all
+	std::string includeGroups;
+	/// ','-separated patterns of registry groups not to document
+	std::string excludeGroups;
+	/// ','-separated plugin names, shorthand for including their "(Plugin) name" groups
+	std::string plugins;
+	/// split the class and function indices into one page per first letter
+	/// (index.html, functions.html) or registry group (groupindex.html,
+	/// groupedfunctions.html), the original pages only link to these
+	bool indexShards;
+	/// write the HTML docu as ugdocu_data.json plus the viewer ugdocu.html
+	/// instead of one page per class and group
+	bool singlePage;
+	/// write the table rows of functions and indices with short CSS classes
+	/// and without optional end tags
+	bool compactMarkup;
+	/// write a gzip compressed copy name.gz next to every output file
+	/// (only if built with DOCUGEN_ZLIB)
+	bool gzip;
+	/// files smaller than this are not compressed
+	size_t gzipMinSize;
+	/// where the files go: files, tar or pack (see OpenOutputSink)
+	std::string sink;
+	/// archive of the tar and pack sinks, "-" is stdout, "" is ugdocu.tar/ugdocu.pack in the base directory
+	std::string sinkFile;
+	/// number of rendered pages ServeScriptReferenceDocu keeps in memory
+	size_t serveCacheSize;
+};
+
+/// splits "a;b=c" into the pairs (a, "") and (b, c), keys and values are trimmed
+void ParseOptionString(const std::string &str, std::vector<std::pair<std::string, std::string> > &entries);
+
+/// value of a boolean option, "" counts as true, previous (with a warning) if the value is no boolean
+bool OptionToBool(const std::string &key, const std::string &value, bool previous);
+
+/// value of a non-negative integer option, previous (with a warning) if the value is no number
+size_t OptionToSize(const std::string &key, const std::string &value, size_t previous);
+
+/// options of the currently running docu generation
+DocuGenOptions &GetDocuGenOptions();
+
+// end group apps_ugdocu
+/// \}
+
+}	// namespace DocuGen
+}	// namespace ug
+
+#endif /* __UG__UGDOCU_OPTIONS_H__ */
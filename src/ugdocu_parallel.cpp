@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2013-2016:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <algorithm>
+#include <thread>
+
+#ifdef UG_PARALLEL
+# include "pcl/pcl_base.h"
+# include "pcl/pcl_util.h"
+#endif
+
+#include "common/error.h"
+
+#include "ugdocu_options.h"
+#include "ugdocu_parallel.h"
+
+namespace ug
+{
+namespace DocuGen
+{
+
+size_t GetNumWorkerThreads()
+{
+	size_t numThreads = GetDocuGenOptions().numThreads;
+	if(numThreads == 0)
+		numThreads = std::thread::hardware_concurrency();
+	return std::max((size_t) 1, std::min(numThreads, MAX_WORKER_THREADS));
+}
+
+size_t GetDocuGenRank()
+{
+#ifdef UG_PARALLEL
+	return pcl::ProcRank();
+#else
+	return 0;
+#endif
+}
+
+size_t GetDocuGenNumRanks()
+{
+#ifdef UG_PARALLEL
+	return pcl::NumProcs();
+#else
+	return 1;
+#endif
+}
+
+size_t NumLocalItems(size_t n)
+{
+	size_t rank = GetDocuGenRank(), numRanks = GetDocuGenNumRanks();
+	if(n <= rank) return 0;
+	return (n - rank + numRanks - 1) / numRanks;
+}
+
+/// set if SynchronizeDocuGenRanks threw because another process failed
+static bool bOtherRankFailed = false;
+
+void SynchronizeDocuGenRanks(bool bFailed)
+{
+#ifdef UG_PARALLEL
+	// the reduction of the error flag is the barrier
+	if(pcl::NumProcs() > 1 && pcl::OneProcTrue(bFailed) && !bFailed)
+	{
+		bOtherRankFailed = true;
+		UG_THROW("DocuGen: the docu generation failed on another process.");
+	}
+#endif
+}
+
+void SynchronizeFailedDocuGenRank()
+{
+	// the other processes already know, they threw in the same reduction
+	if(bOtherRankFailed)
+	{
+		bOtherRankFailed = false;
+		return;
+	}
+	SynchronizeDocuGenRanks(true);
+}
+
+}	// namespace DocuGen
+}	// namespace ug
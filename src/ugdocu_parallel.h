@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2013-2016:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __UG__UGDOCU_PARALLEL_H__
+#define __UG__UGDOCU_PARALLEL_H__
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ug
+{
+namespace DocuGen
+{
+
+/// \addtogroup apps_ugdocu
+/// \{
+
+/// number of worker threads set by the option "threads", at least 1
+size_t GetNumWorkerThreads();
+
+/// shared state of the threads of one ParallelFor
+template<typename TBody>
+class ParallelForWorkers
+{
+public:
+	ParallelForWorkers(size_t n, TBody &body) : m_n(n), m_next(0), m_body(body) {}
+
+	void run(size_t thread)
+	{
+		for(size_t i = m_next++; i < m_n; i = m_next++)
+		{
+			try
+			{
+				m_body(i, thread);
+			}
+			catch(...)
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				if(!m_error) m_error = std::current_exception();
+				m_next = m_n;
+			}
+		}
+	}
+
+	void rethrow()
+	{
+		if(m_error) std::rethrow_exception(m_error);
+	}
+
+private:
+	size_t m_n;
+	std::atomic<size_t> m_next;
+	TBody &m_body;
+	std::mutex m_mutex;
+	std::exception_ptr m_error;
+};
+
+/**
+ * \brief Calls body(i, thread) for all i in [0, n) on GetNumWorkerThreads() threads
+ * \details Indices are handed out one by one, so expensive items don't stall
+ *   a whole thread. thread is in [0, GetNumWorkerThreads()) and can be used
+ *   to index per-thread state. With one worker thread, everything runs in the
+ *   calling thread in order.
+ *   The first exception thrown by body stops handing out indices and is
+ *   rethrown in the calling thread after all threads finished.
+ */
+template<typename TBody>
+void ParallelFor(size_t n, TBody &body)
+{
+	size_t numThreads = std::min(GetNumWorkerThreads(), n);
+	if(numThreads <= 1)
+	{
+		for(size_t i=0; i<n; i++)
+			body(i, 0);
+		return;
+	}
+
+	ParallelForWorkers<TBody> workers(n, body);
+	std::vector<std::thread> threads;
+	for(size_t t=1; t<numThreads; t++)
+		threads.push_back(std::thread(&ParallelForWorkers<TBody>::run, &workers, t));
+	workers.run(0);
+	for(size_t t=0; t<threads.size(); t++)
+		threads[t].join();
+	workers.rethrow();
+}
+
+/// rank of this process among the processes generating the docu, 0 without UG_PARALLEL
+size_t GetDocuGenRank();
+/// number of processes generating the docu (e.g. started by mpirun), 1 without UG_PARALLEL
+size_t GetDocuGenNumRanks();
+/// whether this process writes the files existing only once (indices, manifests)
+inline bool IsOutputRank() { return GetDocuGenRank() == 0; }
+/// whether item i of a partitioned loop is handled by this process (round robin)
+inline bool IsLocalItem(size_t i) { return i % GetDocuGenNumRanks() == GetDocuGenRank(); }
+/// number of items in [0, n) handled by this process
+size_t NumLocalItems(size_t n);
+/**
+ * \brief Waits until all processes arrived here, does nothing with one process
+ * \details The processes also agree on bFailed: if another process passed
+ *   true, this one throws instead of going on. Only to be called by the main
+ *   thread, all processes have to call it equally often.
+ */
+void SynchronizeDocuGenRanks(bool bFailed = false);
+
+/**
+ * \brief Lets the other processes know that this one failed
+ * \details To be called once when an error leaves a docu generation call.
+ *   The processes still running meet it in their next
+ *   SynchronizeDocuGenRanks and throw there, instead of waiting forever for
+ *   this process. Does nothing if the error is from such a
+ *   SynchronizeDocuGenRanks.
+ */
+void SynchronizeFailedDocuGenRank();
+
+/// maps the local items of this process to the items of a DistributedParallelFor
+template<typename TBody>
+class LocalItemsBody
+{
+public:
+	LocalItemsBody(TBody &body) : m_body(body), m_rank(GetDocuGenRank()), m_numRanks(GetDocuGenNumRanks()) {}
+
+	void operator()(size_t i, size_t thread)
+	{
+		m_body(m_rank + i*m_numRanks, thread);
+	}
+
+private:
+	TBody &m_body;
+	size_t m_rank;
+	size_t m_numRanks;
+};
+
+/**
+ * \brief Like ParallelFor, but only calls body(i, thread) for the i with IsLocalItem(i)
+ * \details Every process writes its share of the files with GetNumWorkerThreads()
+ *   threads. All processes have to call it with the same n.
+ */
+template<typename TBody>
+void DistributedParallelFor(size_t n, TBody &body)
+{
+	LocalItemsBody<TBody> localBody(body);
+	ParallelFor(NumLocalItems(n), localBody);
+}
+
+// end group apps_ugdocu
+/// \}
+
+}	// namespace DocuGen
+}	// namespace ug
+
+#endif /* __UG__UGDOCU_PARALLEL_H__ */
@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) 2013-2016:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <atomic>
+#include <cstring>
+#include <ctime>
+#include <map>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+#if defined(__linux__) || defined(__APPLE__)
+# include <sys/time.h>
+# include <sys/resource.h>
+#endif
+
+#include "common/log.h"
+#include "common/error.h"
+#include "compile_info/compile_info.h"
+
+#include "ugdocu_misc.h"
+#include "ugdocu_profiling.h"
+
+using namespace std;
+
+namespace ug
+{
+namespace DocuGen
+{
+
+static vector<PhaseStatistics> phases;
+/// phase path -> index into phases
+static map<string, size_t> phaseIndex;
+/// indices of the phases currently running, innermost last
+static vector<size_t> activePhases;
+/// totals of everything written, also outside of phases
+static PhaseStatistics totals;
+
+class TraceEvent
+{
+public:
+	const char *category;
+	std::string name;
+	double startUS;
+	double durationUS;
+	size_t thread;
+};
+
+static std::atomic<bool> bTracing(false);
+static double traceStartMS = 0;
+static vector<TraceEvent> traceEvents;
+static std::mutex traceMutex;
+
+/// small consecutive thread numbers for the trace, main thread is 1
+static size_t GetTraceThreadID()
+{
+	static std::mutex idMutex;
+	static map<std::thread::id, size_t> ids;
+	std::lock_guard<std::mutex> lock(idMutex);
+	map<std::thread::id, size_t>::iterator it = ids.find(std::this_thread::get_id());
+	if(it != ids.end()) return it->second;
+	size_t id = ids.size()+1;
+	ids[std::this_thread::get_id()] = id;
+	return id;
+}
+
+static double GetWallMS()
+{
+#if defined(__linux__) || defined(__APPLE__)
+	timeval tv;
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0;
+#else
+	return time(NULL) * 1000.0;
+#endif
+}
+
+static double GetCpuMS()
+{
+	return clock() * 1000.0 / CLOCKS_PER_SEC;
+}
+
+static long GetPeakRSSKB()
+{
+#if defined(__linux__)
+	rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	return usage.ru_maxrss;
+#elif defined(__APPLE__)
+	rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	return usage.ru_maxrss / 1024;
+#else
+	return 0;
+#endif
+}
+
+TraceSpan::TraceSpan(const char *category, const char *name) :
+	  m_category( category )
+	, m_start( 0 )
+	, m_bEnabled( bTracing )
+{
+	if(m_bEnabled) start(name, strlen(name));
+}
+
+TraceSpan::TraceSpan(const char *category, const string &name) :
+	  m_category( category )
+	, m_start( 0 )
+	, m_bEnabled( bTracing )
+{
+	if(m_bEnabled) start(name.c_str(), name.size());
+}
+
+void TraceSpan::start(const char *name, size_t len)
+{
+	m_name.assign(name, len);
+	m_start = GetWallMS();
+}
+
+TraceSpan::~TraceSpan()
+{
+	if(!m_bEnabled) return;
+	TraceEvent e;
+	e.category = m_category;
+	e.name.swap(m_name);
+	e.durationUS = (GetWallMS() - m_start) * 1000.0;
+	e.thread = GetTraceThreadID();
+	// traceStartMS is reset by EnableTracing
+	std::lock_guard<std::mutex> lock(traceMutex);
+	e.startUS = (m_start - traceStartMS) * 1000.0;
+	traceEvents.push_back(e);
+}
+
+void EnableTracing(bool bEnable)
+{
+	std::lock_guard<std::mutex> lock(traceMutex);
+	bTracing = bEnable;
+	traceStartMS = GetWallMS();
+	traceEvents.clear();
+}
+
+bool IsTracingEnabled()
+{
+	return bTracing;
+}
+
+void WriteTraceEvents(const string &filename)
+{
+	try{
+	std::lock_guard<std::mutex> lock(traceMutex);
+	ofstream f(filename.c_str());
+	if(!f) UG_THROW("could not open '" << filename << "' for writing.");
+	f << fixed;
+	f.precision(1);
+	f << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+	for(size_t i=0; i<traceEvents.size(); i++)
+	{
+		const TraceEvent &e = traceEvents[i];
+		if(i > 0) f << ",\n";
+		f << "{\"name\": \"" << JSONStringEscape(e.name) << "\", \"cat\": \"" << e.category
+			<< "\", \"ph\": \"X\", \"ts\": " << e.startUS << ", \"dur\": " << e.durationUS
+			<< ", \"pid\": 1, \"tid\": " << e.thread << "}";
+	}
+	f << "\n]}\n";
+	UG_LOG("Wrote " << traceEvents.size() << " trace events to " << filename << "\n");
+	}UG_CATCH_THROW_FUNC();
+}
+
+PhaseTimer::PhaseTimer(const char *name) :
+	  m_span( "phase", name )
+{
+	string path = name;
+	if(!activePhases.empty())
+		path = phases[activePhases.back()].name + "/" + name;
+
+	map<string, size_t>::iterator it = phaseIndex.find(path);
+	if(it == phaseIndex.end())
+	{
+		m_phase = phases.size();
+		phaseIndex[path] = m_phase;
+		phases.push_back(PhaseStatistics());
+		phases.back().name = path;
+		phases.back().depth = activePhases.size();
+	}
+	else
+		m_phase = it->second;
+
+	activePhases.push_back(m_phase);
+	m_wallStart = GetWallMS();
+	m_cpuStart = GetCpuMS();
+	m_peakRSSStart = GetPeakRSSKB();
+}
+
+PhaseTimer::~PhaseTimer()
+{
+	PhaseStatistics &p = phases[m_phase];
+	p.calls++;
+	p.wallMS += GetWallMS() - m_wallStart;
+	p.cpuMS += GetCpuMS() - m_cpuStart;
+	long peakRSS = GetPeakRSSKB();
+	p.processPeakRSSKB = max(p.processPeakRSSKB, peakRSS);
+	p.peakRSSGrowthKB = max(p.peakRSSGrowthKB, peakRSS - m_peakRSSStart);
+	activePhases.pop_back();
+}
+
+// files are also written by ParallelFor workers, phases only change in the main thread
+static std::mutex fileMutex;
+
+void RecordFileWritten(size_t bytes)
+{
+	std::lock_guard<std::mutex> lock(fileMutex);
+	totals.filesCreated++;
+	totals.bytesWritten += bytes;
+	for(size_t i=0; i<activePhases.size(); i++)
+	{
+		phases[activePhases[i]].filesCreated++;
+		phases[activePhases[i]].bytesWritten += bytes;
+	}
+}
+
+void RecordSidecarWritten(size_t bytes)
+{
+	std::lock_guard<std::mutex> lock(fileMutex);
+	totals.sidecarsCreated++;
+	totals.sidecarBytesWritten += bytes;
+	for(size_t i=0; i<activePhases.size(); i++)
+	{
+		phases[activePhases[i]].sidecarsCreated++;
+		phases[activePhases[i]].sidecarBytesWritten += bytes;
+	}
+}
+
+void ResetProfiling()
+{
+	phases.clear();
+	phaseIndex.clear();
+	activePhases.clear();
+	totals = PhaseStatistics();
+}
+
+const vector<PhaseStatistics> &GetPhaseStatistics()
+{
+	return phases;
+}
+
+static void WritePhaseJSON(ostream &out, const PhaseStatistics &p)
+{
+	out << "{\"name\": \"" << JSONStringEscape(p.name) << "\", \"depth\": " << p.depth
+		<< ", \"calls\": " << p.calls << ", \"wall_ms\": " << p.wallMS << ", \"cpu_ms\": " << p.cpuMS
+		<< ", \"process_peak_rss_kb\": " << p.processPeakRSSKB
+		<< ", \"peak_rss_growth_kb\": " << p.peakRSSGrowthKB << ", \"files\": " << p.filesCreated
+		<< ", \"bytes\": " << p.bytesWritten << ", \"gzip_files\": " << p.sidecarsCreated
+		<< ", \"gzip_bytes\": " << p.sidecarBytesWritten << "}";
+}
+
+void WriteProfilingReport(const string &filename)
+{
+	try{
+	// written directly, the report should not count itself
+	ofstream f(filename.c_str());
+	if(!f) UG_THROW("could not open '" << filename << "' for writing.");
+
+	time_t now = time(0);
+	char date[32];
+	strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+
+	PhaseStatistics total = totals;
+	total.name = "total";
+	total.processPeakRSSKB = GetPeakRSSKB();
+	for(size_t i=0; i<phases.size(); i++)
+		if(phases[i].depth == 0)
+		{
+			total.wallMS += phases[i].wallMS;
+			total.cpuMS += phases[i].cpuMS;
+		}
+
+	f << "{\n";
+	f << "\"generator\": \"ugdocu\",\n";
+	f << "\"revision\": \"" << JSONStringEscape(UGSvnRevision()) << "\",\n";
+	f << "\"date\": \"" << date << "\",\n";
+	f << "\"total\": ";
+	WritePhaseJSON(f, total);
+	f << ",\n\"phases\": [\n";
+	for(size_t i=0; i<phases.size(); i++)
+	{
+		if(i > 0) f << ",\n";
+		WritePhaseJSON(f, phases[i]);
+	}
+	f << "\n]\n}\n";
+	UG_LOG("Wrote profiling report to " << filename << "\n");
+	}UG_CATCH_THROW_FUNC();
+}
+
+}	// namespace DocuGen
+}	// namespace ug
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2013-2016:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __UG__UGDOCU_PROFILING_H__
+#define __UG__UGDOCU_PROFILING_H__
+
+#include <string>
+#include <vector>
+
+namespace ug
+{
+namespace DocuGen
+{
+
+/// \addtogroup apps_ugdocu
+/// \{
+
+/// accumulated statistics of one (sub-)phase of the docu generation
+class PhaseStatistics
+{
+public:
+	PhaseStatistics() : depth(0), calls(0), wallMS(0), cpuMS(0), processPeakRSSKB(0), peakRSSGrowthKB(0),
+		filesCreated(0), bytesWritten(0), sidecarsCreated(0), sidecarBytesWritten(0) {}
+
+	std::string name;		///< path of the phase, e.g. "WriteHTMLDocu/WriteClassHTML"
+	size_t depth;
+	size_t calls;
+	double wallMS;
+	double cpuMS;
+	/// peak resident set size of the process so far (at the end of the phase),
+	/// includes everything before the phase
+	long processPeakRSSKB;
+	/// how much the phase raised the process peak, the maximum over its calls
+	long peakRSSGrowthKB;
+	size_t filesCreated;	///< files written while the phase was active (including sub-phases)
+	size_t bytesWritten;
+	size_t sidecarsCreated;	///< gzip sidecars (option gzip), not counted in filesCreated
+	size_t sidecarBytesWritten;
+};
+
+/**
+ * \brief Records the enclosing scope as span in the trace (if tracing is enabled)
+ * \details Spans are exported in the Chrome trace-event format by WriteTraceEvents
+ *   and can be viewed in chrome://tracing or Perfetto. If tracing is disabled,
+ *   constructing a TraceSpan costs one branch, the name is only copied when
+ *   tracing is enabled (callers should pass names they already have instead
+ *   of building temporaries). Spans may be created in any thread.
+ */
+class TraceSpan
+{
+public:
+	TraceSpan(const char *category, const char *name);
+	TraceSpan(const char *category, const std::string &name);
+	~TraceSpan();
+
+private:
+	void start(const char *name, size_t len);
+
+	const char *m_category;
+	std::string m_name;
+	double m_start;
+	bool m_bEnabled;
+};
+
+/**
+ * \brief Measures the enclosing scope as a phase of the docu generation
+ * \details Phases nest, a PhaseTimer created while another one is alive is
+ *   recorded as sub-phase. Several scopes with the same name and parent are
+ *   accumulated into one PhaseStatistics.
+ *
+ *       {
+ *           PhaseTimer phase("WriteGroups");
+ *           ...
+ *       }
+ *
+ *   Each phase is also recorded as TraceSpan of category "phase".
+ */
+class PhaseTimer
+{
+public:
+	PhaseTimer(const char *name);
+	~PhaseTimer();
+
+private:
+	TraceSpan m_span;
+	size_t m_phase;
+	double m_wallStart;
+	double m_cpuStart;
+	long m_peakRSSStart;
+};
+
+/// enables/disables recording of TraceSpans and clears recorded spans
+void EnableTracing(bool bEnable);
+bool IsTracingEnabled();
+/// writes all recorded spans in Chrome trace-event JSON
+void WriteTraceEvents(const std::string &filename);
+
+/// counts a written file for all active phases, may be called from any thread
+void RecordFileWritten(size_t bytes);
+/// counts a written gzip sidecar of bytes compressed bytes, may be called from any thread
+void RecordSidecarWritten(size_t bytes);
+
+/// clears all recorded phases
+void ResetProfiling();
+
+const std::vector<PhaseStatistics> &GetPhaseStatistics();
+
+/// writes all recorded phases as JSON
+void WriteProfilingReport(const std::string &filename);
+
+// end group apps_ugdocu
+/// \}
+
+}	// namespace DocuGen
+}	// namespace ug
+
+#endif /* __UG__UGDOCU_PROFILING_H__ */
@@ -0,0 +1,113 @@
+// incremental search over ugdocuSearchIndex of search_index.js
+// entries are [name, kind, page, context], sorted by lower case name.
+// The text search uses the inverted index of search_text_index.js.
+(function() {
+  var maxResults = 100;
+  var kindNames = { c: "class", g: "class group", r: "group", m: "member function", f: "function" };
+  var keys = new Array(ugdocuSearchIndex.length);
+  for (var i = 0; i < ugdocuSearchIndex.length; i++) {
+    keys[i] = ugdocuSearchIndex[i][0].toLowerCase();
+  }
+
+  // first element of the sorted array a which is not less than q
+  function lowerBound(a, q) {
+    var lo = 0, hi = a.length;
+    while (lo < hi) {
+      var mid = (lo + hi) >> 1;
+      if (a[mid] < q) lo = mid + 1; else hi = mid;
+    }
+    return lo;
+  }
+
+  function escapeHTML(s) {
+    return s.replace(/&/g, "&amp;").replace(/</g, "&lt;").replace(/>/g, "&gt;");
+  }
+
+  function link(e) {
+    var url = ugdocuSearchPages[e[2]];
+    if (e[1] == "m") url += "#" + e[3] + "." + e[0];
+    else if (e[1] == "f") url += "#" + e[0];
+    return url;
+  }
+
+  // shows the entries with the given ids
+  function showResults(ids) {
+    var out = [];
+    for (var i = 0; i < ids.length; i++) {
+      if (out.length == maxResults) {
+        out.push("<tr><td></td><td>... " + (ids.length - maxResults) + " more</td></tr>");
+        break;
+      }
+      var e = ugdocuSearchIndex[ids[i]];
+      var name = e[1] == "m" ? e[3] + "::" + e[0] : e[0];
+      out.push("<tr><td class=\"memItemLeft\" nowrap align=right valign=top>" + kindNames[e[1]] +
+        "</td><td class=\"memItemRight\" valign=bottom><a class=\"el\" href=\"" + link(e) + "\">" +
+        escapeHTML(name) + "</a>" + (e[1] != "m" && e[3] ? " <small>" + escapeHTML(e[3]) + "</small>" : "") +
+        "</td></tr>");
+    }
+    document.getElementById("ugdocuSearchResults").innerHTML =
+      "<table border=0 cellpadding=0 cellspacing=0>" + out.join("") + "</table>";
+  }
+
+  // entries whose name starts with query
+  function search(query) {
+    var q = query.replace(/^\s+|\s+$/g, "").toLowerCase();
+    var ids = [];
+    if (q.length > 0) {
+      for (var i = lowerBound(keys, q); i < keys.length && keys[i].indexOf(q) == 0; i++) {
+        ids.push(i);
+      }
+    }
+    showResults(ids);
+  }
+
+  // decodes the delta encoded posting list of term t
+  function postings(t) {
+    var deltas = ugdocuTextPostings[t].split(","), ids = new Array(deltas.length), id = 0;
+    for (var i = 0; i < deltas.length; i++) {
+      id += parseInt(deltas[i], 36);
+      ids[i] = id;
+    }
+    return ids;
+  }
+
+  // words ugdocu doesn't index, see TokenizeText in search_index.cpp
+  var stopWords = {};
+  if (typeof ugdocuTextStopWords != "undefined") {
+    for (var i = 0; i < ugdocuTextStopWords.length; i++) stopWords[ugdocuTextStopWords[i]] = true;
+  }
+
+  // entries having terms starting with each of the query words, sorted by id
+  function textSearch(query) {
+    var words = query.toLowerCase().split(/[^a-z0-9]+/), result = null;
+    for (var w = 0; w < words.length; w++) {
+      if (words[w].length < 2 || stopWords.hasOwnProperty(words[w])) continue;
+      var found = {};
+      for (var t = lowerBound(ugdocuTextTerms, words[w]);
+           t < ugdocuTextTerms.length && ugdocuTextTerms[t].indexOf(words[w]) == 0; t++) {
+        var ids = postings(t);
+        for (var i = 0; i < ids.length; i++) {
+          if (result == null || result[ids[i]]) found[ids[i]] = true;
+        }
+      }
+      result = found;
+    }
+    var ids = [];
+    if (result != null) {
+      for (var id in result) ids.push(+id);
+      ids.sort(function(a, b) { return a - b; });
+    }
+    showResults(ids);
+  }
+
+  var input = document.getElementById("ugdocuSearchInput");
+  input.onkeyup = function() { search(input.value); };
+  input.oninput = input.onkeyup;
+  input.focus();
+
+  var textInput = document.getElementById("ugdocuTextInput");
+  if (textInput && typeof ugdocuTextTerms != "undefined") {
+    textInput.onkeyup = function() { textSearch(textInput.value); };
+    textInput.oninput = textInput.onkeyup;
+  }
+})();